@@ -0,0 +1,208 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamAllocCommandlet.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamAllocGuard.h"
+#include "BodycamBenchmarkCommandlet.h"
+#include "BodycamCharacter.h"
+#include "BodycamMotionSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "InputActionValue.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace BodycamAllocTest
+{
+	static constexpr float Dt = 1.f / 60.f;
+	static constexpr float PawnSpacing = 300.f;
+	static constexpr int32 LookEventsPerFrame = 4; // high polling rate mouse
+}
+
+UBodycamAllocCommandlet::UBodycamAllocCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UBodycamAllocCommandlet::Main(const FString& Params)
+{
+	using namespace BodycamAllocTest;
+
+	int32 NumPawns = 200;
+	int32 Frames = 5000;
+	int32 WarmupFrames = 300;
+	FParse::Value(*Params, TEXT("Pawns="), NumPawns);
+	FParse::Value(*Params, TEXT("Frames="), Frames);
+	FParse::Value(*Params, TEXT("Warmup="), WarmupFrames);
+	NumPawns = FMath::Max(1, NumPawns);
+	Frames = FMath::Max(1, Frames);
+	WarmupFrames = FMath::Max(0, WarmupFrames);
+
+	FString OutDir = FPaths::ProjectSavedDir() / TEXT("Profiling/Bodycam");
+	FParse::Value(*Params, TEXT("Out="), OutDir);
+
+	UWorld* World = UBodycamBenchmarkCommandlet::CreateBenchmarkWorld(TEXT("BodycamAlloc"));
+	if (!World)
+	{
+		UE_LOG(LogBodycam, Error, TEXT("Could not create the test world"));
+		return 1;
+	}
+
+	// pawn 0 is possessed and gets its input through the handlers; the rest walk on their own
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	TArray<ABodycamCharacter*> Pawns;
+	const int32 Side = FMath::CeilToInt(FMath::Sqrt((float)NumPawns));
+	for (int32 i = 0; i < NumPawns; ++i)
+	{
+		const FVector Loc((i % Side) * PawnSpacing, (i / Side) * PawnSpacing, 100.f);
+		if (ABodycamCharacter* Pawn = World->SpawnActor<ABodycamCharacter>(ABodycamCharacter::StaticClass(), Loc, FRotator::ZeroRotator, SpawnParams))
+		{
+			Pawn->GetCharacterMovement()->bRunPhysicsWithNoController = true;
+			Pawns.Add(Pawn);
+		}
+	}
+	APlayerController* PC = World->SpawnActor<APlayerController>(APlayerController::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+	if (!PC || Pawns.Num() == 0)
+	{
+		UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+		UE_LOG(LogBodycam, Error, TEXT("Could not spawn the test pawns"));
+		return 1;
+	}
+	PC->Possess(Pawns[0]);
+
+	UE_LOG(LogBodycam, Display, TEXT("Alloc: %d pawns, %d warm-up + %d guarded frames"), Pawns.Num(), WarmupFrames, Frames);
+
+	// latency tracking is switched on halfway through the guarded frames: the tracker it creates
+	// must be allocated outside the guarded scopes, and tracking must not allocate per frame
+	IConsoleVariable* LatencyTrack = IConsoleManager::Get().FindConsoleVariable(TEXT("bodycam.Latency.Track"));
+	const bool bLatencyTrackWas = LatencyTrack && LatencyTrack->GetBool();
+	if (LatencyTrack)
+	{
+		LatencyTrack->Set(false);
+	}
+	const int32 LatencyFrame = WarmupFrames + Frames / 2;
+
+	for (int32 Frame = 0; Frame < WarmupFrames + Frames; ++Frame)
+	{
+		if (Frame == WarmupFrames && !FBodycamAllocGuard::Install())
+		{
+			UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+			UE_LOG(LogBodycam, Error, TEXT("The allocation guard is compiled out of this build (BODYCAM_ALLOC_GUARD)"));
+			return 1;
+		}
+		if (Frame == LatencyFrame && LatencyTrack)
+		{
+			LatencyTrack->Set(true);
+		}
+
+		DriveInput(Pawns[0], Frame, Dt);
+		for (int32 i = 1; i < Pawns.Num(); ++i)
+		{
+			UBodycamBenchmarkCommandlet::DriveSyntheticInput(Pawns[i], i, Frame, Dt);
+		}
+
+		World->Tick(LEVELTICK_All, Dt);
+		++GFrameCounter;
+	}
+	FBodycamAllocGuard::Uninstall();
+
+	const bool bTracked = Pawns[0]->GetLatencyTracker() != nullptr;
+	if (LatencyTrack)
+	{
+		LatencyTrack->Set(bLatencyTrackWas);
+	}
+
+	const uint64 Total = FBodycamAllocGuard::GetTotalAllocs();
+	for (int32 Scope = 0; Scope < static_cast<int32>(EBodycamAllocScope::Num); ++Scope)
+	{
+		const EBodycamAllocScope S = static_cast<EBodycamAllocScope>(Scope);
+		const uint64 Allocs = FBodycamAllocGuard::GetNumAllocs(S);
+		UE_LOG(LogBodycam, Display, TEXT("  %-12s %8llu allocs %10llu bytes"), FBodycamAllocGuard::GetScopeName(S), Allocs, FBodycamAllocGuard::GetNumBytes(S));
+	}
+
+	ReportFootprint(Pawns[0], OutDir);
+	UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+
+	if (!bTracked)
+	{
+		UE_LOG(LogBodycam, Error, TEXT("Alloc: FAILED, the possessed pawn has no latency tracker after bodycam.Latency.Track was turned on"));
+		return 1;
+	}
+	if (Total > 0)
+	{
+		UE_LOG(LogBodycam, Error, TEXT("Alloc: FAILED, %llu heap allocations in per-frame scopes over %d frames"), Total, Frames);
+		return 1;
+	}
+	UE_LOG(LogBodycam, Display, TEXT("Alloc: no heap allocations in per-frame scopes over %d frames (latency tracking on from frame %d)"), Frames, LatencyFrame - WarmupFrames);
+	return 0;
+}
+
+void UBodycamAllocCommandlet::DriveInput(ABodycamCharacter* Pawn, int32 Frame, float DeltaSeconds)
+{
+	using namespace BodycamAllocTest;
+
+	// 4 s loop: walk, strafe, sprint, walk back with a jump; the view sways side to side
+	const int32 Phase = Frame % 240;
+	FVector2D Axis(0.f, 1.f);
+	if (Phase >= 60 && Phase < 120)
+	{
+		Axis = FVector2D(1.f, 0.f);
+	}
+	else if (Phase >= 180)
+	{
+		Axis = FVector2D(0.f, -1.f);
+	}
+	Pawn->SetSprinting(Phase >= 120 && Phase < 180);
+	if (Phase == 200) Pawn->Jump();
+	if (Phase == 201) Pawn->StopJumping();
+
+	const float T = Frame * DeltaSeconds;
+	for (int32 Event = 0; Event < LookEventsPerFrame; ++Event)
+	{
+		Pawn->Look(FInputActionValue(FVector2D(0.4f * FMath::Sin(T * 1.7f), 0.2f * FMath::Cos(T * 1.1f))));
+	}
+	Pawn->Move(FInputActionValue(Axis));
+}
+
+void UBodycamAllocCommandlet::ReportFootprint(ABodycamCharacter* Pawn, const FString& OutDir)
+{
+	FString Csv = TEXT("object,class,object_bytes,resource_bytes\n");
+	SIZE_T Total = 0;
+
+	auto AddRow = [&Csv, &Total](const FString& Name, const FString& ClassName, SIZE_T ObjectBytes, SIZE_T ResourceBytes)
+	{
+		UE_LOG(LogBodycam, Display, TEXT("  %-24s %-36s %8llu + %8llu bytes"), *Name, *ClassName, (uint64)ObjectBytes, (uint64)ResourceBytes);
+		Csv += FString::Printf(TEXT("%s,%s,%llu,%llu\n"), *Name, *ClassName, (uint64)ObjectBytes, (uint64)ResourceBytes);
+		Total += ObjectBytes + ResourceBytes;
+	};
+
+	UE_LOG(LogBodycam, Display, TEXT("Footprint of one %s (object + exclusive resource size):"), *Pawn->GetClass()->GetName());
+	AddRow(Pawn->GetName(), Pawn->GetClass()->GetName(), Pawn->GetClass()->GetStructureSize(), Pawn->GetResourceSizeBytes(EResourceSizeMode::Exclusive));
+
+	TInlineComponentArray<UActorComponent*> Components(Pawn);
+	for (UActorComponent* Component : Components)
+	{
+		AddRow(Component->GetName(), Component->GetClass()->GetName(), Component->GetClass()->GetStructureSize(), Component->GetResourceSizeBytes(EResourceSizeMode::Exclusive));
+	}
+
+	// the pawn's slot in the batched motion state (slack shared out evenly)
+	if (const UBodycamMotionSubsystem* Motion = Pawn->GetWorld()->GetSubsystem<UBodycamMotionSubsystem>())
+	{
+		AddRow(TEXT("MotionState"), TEXT("UBodycamMotionSubsystem"), Motion->GetAllocatedSize() / FMath::Max(1, Motion->GetNumPawns()), 0);
+	}
+
+	UE_LOG(LogBodycam, Display, TEXT("  %-24s %-36s %8llu bytes"), TEXT("Total"), TEXT(""), (uint64)Total);
+	Csv += FString::Printf(TEXT("Total,,%llu,0\n"), (uint64)Total);
+
+	const FString Stamp = FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"));
+	const FString CsvPath = OutDir / FString::Printf(TEXT("BodycamAlloc-%s.csv"), *Stamp);
+	FFileHelper::SaveStringToFile(Csv, *CsvPath);
+	UE_LOG(LogBodycam, Display, TEXT("Footprint written to %s"), *CsvPath);
+}
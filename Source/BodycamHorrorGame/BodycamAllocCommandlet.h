@@ -0,0 +1,41 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BodycamAllocCommandlet.generated.h"
+
+class ABodycamCharacter;
+
+/**
+ * Zero-allocation check for the per-frame bodycam paths, and the per-pawn memory footprint.
+ *
+ *   UnrealEditor-Cmd BodycamHorrorGame -run=BodycamAlloc -nullrhi -unattended
+ *       [-Pawns=200] [-Frames=5000] [-Warmup=300] [-Out=<dir>]
+ *
+ * Spawns one possessed pawn driven through Look / Move like the input handlers, plus Pawns-1
+ * pawns on the synthetic benchmark input (enough by default to take the parallel motion solve),
+ * and steps them at 60 Hz. After Warmup frames (one full synthetic input loop, so every array
+ * has reached its working size) FBodycamAllocGuard counts heap allocations inside the
+ * BODYCAM_NO_ALLOC_SCOPE scopes for Frames frames; any allocation fails the run with the
+ * scope it happened in. bodycam.Latency.Track is turned on halfway through the guarded frames,
+ * so creating the possessed pawn's latency tracker and tracking itself are covered too. Then logs the footprint of the possessed pawn: the actor and each
+ * component (object size + exclusive resource size) and its share of the motion subsystem
+ * state, also written as CSV to Saved/Profiling/Bodycam. Run with -llm to see the
+ * Bodycam / Bodycam/Character tags in `stat LLM` as well. Returns non-zero on any allocation.
+ */
+UCLASS()
+class UBodycamAllocCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBodycamAllocCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	static void DriveInput(ABodycamCharacter* Pawn, int32 Frame, float DeltaSeconds);
+	static void ReportFootprint(ABodycamCharacter* Pawn, const FString& OutDir);
+};
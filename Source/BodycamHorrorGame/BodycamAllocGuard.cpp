@@ -0,0 +1,184 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamAllocGuard.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformMisc.h"
+#include <atomic>
+
+namespace BodycamAllocGuard
+{
+	static constexpr uint8 NoScope = static_cast<uint8>(EBodycamAllocScope::Num);
+	static constexpr int32 NumScopes = static_cast<int32>(EBodycamAllocScope::Num);
+
+	static thread_local uint8 CurrentScope = NoScope;
+
+	static std::atomic<uint64> NumAllocs[NumScopes];
+	static std::atomic<uint64> NumBytes[NumScopes];
+
+	static const TCHAR* ScopeNames[NumScopes] =
+	{
+		TEXT("Look"),
+		TEXT("Move"),
+		TEXT("ResolveLook"),
+		TEXT("LatchView"),
+		TEXT("MotionGather"),
+		TEXT("MotionSolve"),
+		TEXT("MotionApply"),
+	};
+
+	static FORCEINLINE void Note(SIZE_T Size)
+	{
+		const uint8 Scope = CurrentScope;
+		if (Scope != NoScope)
+		{
+			NumAllocs[Scope].fetch_add(1, std::memory_order_relaxed);
+			NumBytes[Scope].fetch_add(Size, std::memory_order_relaxed);
+		}
+	}
+
+	/** Forwards everything to the allocator it replaced; allocations inside a scope are counted on the way. */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		FMalloc* Inner = nullptr;
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Note(Count);
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Note(Count);
+			return Inner->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			// a realloc to zero is a free
+			if (Count > 0)
+			{
+				Note(Count);
+			}
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				Note(Count);
+			}
+			return Inner->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void MarkTLSCachesAsUsedOnCurrentThread() override { Inner->MarkTLSCachesAsUsedOnCurrentThread(); }
+		virtual void MarkTLSCachesAsUnusedOnCurrentThread() override { Inner->MarkTLSCachesAsUnusedOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+		virtual void UpdateStats() override { Inner->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+	};
+
+	// never freed: another thread may still be inside it when the guard is uninstalled
+	static FCountingMalloc* Counting = nullptr;
+}
+
+bool FBodycamAllocGuard::Install()
+{
+#if BODYCAM_ALLOC_GUARD
+	using namespace BodycamAllocGuard;
+
+	check(IsInGameThread());
+	if (IsInstalled())
+	{
+		return true;
+	}
+	if (!Counting)
+	{
+		Counting = new FCountingMalloc();
+	}
+	Counting->Inner = GMalloc;
+	Reset();
+	FPlatformMisc::MemoryBarrier();
+	GMalloc = Counting;
+	return true;
+#else
+	return false;
+#endif
+}
+
+void FBodycamAllocGuard::Uninstall()
+{
+	using namespace BodycamAllocGuard;
+
+	check(IsInGameThread());
+	if (IsInstalled())
+	{
+		GMalloc = Counting->Inner;
+		FPlatformMisc::MemoryBarrier();
+	}
+}
+
+bool FBodycamAllocGuard::IsInstalled()
+{
+	return BodycamAllocGuard::Counting && GMalloc == BodycamAllocGuard::Counting;
+}
+
+void FBodycamAllocGuard::Reset()
+{
+	using namespace BodycamAllocGuard;
+
+	for (int32 Scope = 0; Scope < NumScopes; ++Scope)
+	{
+		NumAllocs[Scope].store(0, std::memory_order_relaxed);
+		NumBytes[Scope].store(0, std::memory_order_relaxed);
+	}
+}
+
+uint64 FBodycamAllocGuard::GetNumAllocs(EBodycamAllocScope Scope)
+{
+	return BodycamAllocGuard::NumAllocs[static_cast<int32>(Scope)].load(std::memory_order_relaxed);
+}
+
+uint64 FBodycamAllocGuard::GetNumBytes(EBodycamAllocScope Scope)
+{
+	return BodycamAllocGuard::NumBytes[static_cast<int32>(Scope)].load(std::memory_order_relaxed);
+}
+
+uint64 FBodycamAllocGuard::GetTotalAllocs()
+{
+	uint64 Total = 0;
+	for (int32 Scope = 0; Scope < BodycamAllocGuard::NumScopes; ++Scope)
+	{
+		Total += GetNumAllocs(static_cast<EBodycamAllocScope>(Scope));
+	}
+	return Total;
+}
+
+const TCHAR* FBodycamAllocGuard::GetScopeName(EBodycamAllocScope Scope)
+{
+	return Scope < EBodycamAllocScope::Num ? BodycamAllocGuard::ScopeNames[static_cast<int32>(Scope)] : TEXT("None");
+}
+
+FBodycamAllocGuard::FScope::FScope(EBodycamAllocScope Scope)
+	: Outer(BodycamAllocGuard::CurrentScope)
+{
+	BodycamAllocGuard::CurrentScope = static_cast<uint8>(Scope);
+}
+
+FBodycamAllocGuard::FScope::~FScope()
+{
+	BodycamAllocGuard::CurrentScope = Outer;
+}
@@ -0,0 +1,59 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// compiled out of shipping builds; the scopes cost two thread-local stores otherwise
+#ifndef BODYCAM_ALLOC_GUARD
+#define BODYCAM_ALLOC_GUARD !UE_BUILD_SHIPPING
+#endif
+
+/** Per-frame bodycam paths that must not touch the heap. */
+enum class EBodycamAllocScope : uint8
+{
+	Look,
+	Move,
+	ResolveLook,
+	LatchView,
+	MotionGather,
+	MotionSolve,
+	MotionApply,
+	Num
+};
+
+/**
+ * Counts heap allocations made inside the per-frame bodycam scopes (BODYCAM_NO_ALLOC_SCOPE).
+ * Nothing is counted until Install() puts a counting FMalloc in front of GMalloc; the
+ * allocation commandlet does that around its measured frames. Allocations are charged to the
+ * innermost scope of the allocating thread, so worker threads running the motion solve are
+ * covered too.
+ */
+struct BODYCAMHORRORGAME_API FBodycamAllocGuard
+{
+	/** Wraps GMalloc; false if the guard is compiled out. */
+	static bool Install();
+	static void Uninstall();
+	static bool IsInstalled();
+
+	static void Reset();
+	static uint64 GetNumAllocs(EBodycamAllocScope Scope);
+	static uint64 GetNumBytes(EBodycamAllocScope Scope);
+	static uint64 GetTotalAllocs();
+	static const TCHAR* GetScopeName(EBodycamAllocScope Scope);
+
+	struct BODYCAMHORRORGAME_API FScope
+	{
+		explicit FScope(EBodycamAllocScope Scope);
+		~FScope();
+
+	private:
+		uint8 Outer;
+	};
+};
+
+#if BODYCAM_ALLOC_GUARD
+#define BODYCAM_NO_ALLOC_SCOPE(Scope) const FBodycamAllocGuard::FScope PREPROCESSOR_JOIN(BodycamAllocScope_, __LINE__)(EBodycamAllocScope::Scope)
+#else
+#define BODYCAM_NO_ALLOC_SCOPE(Scope)
+#endif
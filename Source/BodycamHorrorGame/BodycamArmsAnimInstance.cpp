@@ -0,0 +1,98 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamArmsAnimInstance.h"
+#include "BodycamCharacter.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+
+void UBodycamArmsAnimInstance::NativeInitializeAnimation()
+{
+	Super::NativeInitializeAnimation();
+
+	Character = Cast<ABodycamCharacter>(TryGetPawnOwner());
+
+	// no subsystem in editor previews: the arms just hold their rest pose there
+	const UWorld* World = GetWorld();
+	Motion = World ? World->GetSubsystem<UBodycamMotionSubsystem>() : nullptr;
+	if (UBodycamMotionSubsystem* M = Motion.Get())
+	{
+		if (USkeletalMeshComponent* Mesh = GetSkelMeshComponent())
+		{
+			M->AddTickDependent(Mesh->PrimaryComponentTick);
+		}
+	}
+}
+
+void UBodycamArmsAnimInstance::NativeUninitializeAnimation()
+{
+	UBodycamMotionSubsystem* M = Motion.Get();
+	USkeletalMeshComponent* Mesh = GetSkelMeshComponent();
+	if (M && Mesh)
+	{
+		M->RemoveTickDependent(Mesh->PrimaryComponentTick);
+	}
+	Motion.Reset();
+	Character.Reset();
+
+	Super::NativeUninitializeAnimation();
+}
+
+void UBodycamArmsAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeUpdateAnimation(DeltaSeconds);
+
+	// the only game thread work: one copy out of the subsystem's arrays
+	const ABodycamCharacter* Pawn = Character.Get();
+	const UBodycamMotionSubsystem* M = Motion.Get();
+	bHasPose = Pawn && M && M->GetArmsPose(Pawn, Pose);
+
+	// our own arms every frame; everyone else's may skip frames by screen size
+	USkeletalMeshComponent* Mesh = GetSkelMeshComponent();
+	const bool bUseURO = Pawn && !Pawn->IsLocallyControlled();
+	if (Mesh && Mesh->bEnableUpdateRateOptimizations != bUseURO)
+	{
+		Mesh->bEnableUpdateRateOptimizations = bUseURO;
+	}
+}
+
+void UBodycamArmsAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	// with update rate optimizations DeltaSeconds spans the skipped frames, so the smoothing holds up
+	FVector TargetOffset = FVector::ZeroVector;
+	FRotator TargetRotation = FRotator::ZeroRotator;
+	float TargetSprint = 0.f;
+	if (bHasPose)
+	{
+		const float Sway = Pose.MoveAlpha * Pose.Detail;
+		const float HalfPhase = Pose.BobPhase * 0.5f;
+
+		// a view-driven pivot stays put and the camera modifier moves the final view instead, so the
+		// arms (under FPCamera) first take the view's motion themselves, then lag it like the others
+		const FVector  RiddenOffset = Pose.bViewDriven ? Pose.PivotOffset : FVector::ZeroVector;
+		const FRotator ViewRotation = Pose.bViewDriven ? FRotator(Pose.PivotPitch, 0.f, Pose.PivotRoll) : FRotator::ZeroRotator;
+
+		TargetOffset = RiddenOffset - Pose.PivotOffset * PivotFollow
+			+ Pose.BreathNoise * (BreathSway * Pose.BreathLevel * Pose.Detail)
+			+ FVector(0.f, 0.f, Pose.LandingOffset * LandingDipScale);
+
+		TargetSprint = (Pose.bSprinting && Pose.bGrounded) ? Pose.MoveAlpha : 0.f;
+
+		TargetRotation.Pitch = ViewRotation.Pitch - Pose.PivotPitch * PivotFollow
+			+ FMath::Sin(Pose.BobPhase) * BobSwayPitchDeg * Sway
+			+ Pose.FlashKickPitch * KickPitchScale
+			- SprintAlpha * SprintPitchDeg;
+		TargetRotation.Yaw  = FMath::Sin(HalfPhase) * BobSwayYawDeg * Sway;
+		TargetRotation.Roll = ViewRotation.Roll - Pose.PivotRoll * PivotFollow + FMath::Sin(HalfPhase) * BobSwayRollDeg * Sway;
+
+		// the beam is drawn relative to the final view; bring it back under FPCamera for view-driven pawns
+		const FRotator LightRotation(Pose.LightPitch, Pose.LightYaw, 0.f);
+		FlashHandRotation = Pose.bViewDriven ? (FQuat(ViewRotation) * FQuat(LightRotation)).Rotator() : LightRotation;
+	}
+
+	SprintAlpha  = FMath::FInterpTo(SprintAlpha, TargetSprint, DeltaSeconds, SprintBlendSpeed);
+	ArmsOffset   = FMath::VInterpTo(ArmsOffset, TargetOffset, DeltaSeconds, InterpSpeed);
+	ArmsRotation = FMath::RInterpTo(ArmsRotation, TargetRotation, DeltaSeconds, InterpSpeed);
+}
@@ -0,0 +1,83 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimInstance.h"
+#include "BodycamMotionSubsystem.h"
+#include "BodycamArmsAnimInstance.generated.h"
+
+class ABodycamCharacter;
+
+/**
+ * Native base for the first-person arms (3DPixelArms rigs). The game thread only copies the
+ * pawn's FBodycamArmsPose out of UBodycamMotionSubsystem; arm and flashlight-hand sway are
+ * evaluated in NativeThreadSafeUpdateAnimation on a worker. The anim graph of a child AnimBP
+ * feeds ArmsOffset / ArmsRotation / FlashHandRotation / SprintAlpha into its bone nodes, or binds
+ * Pose with property access from thread-safe functions; it needs no event graph.
+ *
+ * The mesh ticks after the bodycam update, so the arms use the same frame's state as the camera
+ * and the beam. Arms of pawns nobody looks through run with update rate optimizations.
+ */
+UCLASS(Transient, Blueprintable)
+class BODYCAMHORRORGAME_API UBodycamArmsAnimInstance : public UAnimInstance
+{
+	GENERATED_BODY()
+
+public:
+	// UAnimInstance
+	virtual void NativeInitializeAnimation() override;
+	virtual void NativeUninitializeAnimation() override;
+	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
+protected:
+	/** The owning pawn's bodycam state this frame (copied on the game thread, read-only afterwards). */
+	UPROPERTY(Transient, BlueprintReadOnly, Category="Bodycam|Arms")
+	FBodycamArmsPose Pose;
+
+	// ===== Outputs (worker thread) =====
+	UPROPERTY(Transient, BlueprintReadOnly, Category="Bodycam|Arms")
+	FVector ArmsOffset = FVector::ZeroVector;   // cm, camera space
+
+	UPROPERTY(Transient, BlueprintReadOnly, Category="Bodycam|Arms")
+	FRotator ArmsRotation = FRotator::ZeroRotator;
+
+	/** Where the beam points relative to FPCamera; unsmoothed so the hand never trails the light. */
+	UPROPERTY(Transient, BlueprintReadOnly, Category="Bodycam|Arms")
+	FRotator FlashHandRotation = FRotator::ZeroRotator;
+
+	UPROPERTY(Transient, BlueprintReadOnly, Category="Bodycam|Arms")
+	float SprintAlpha = 0.f;
+
+	// ===== Tuning =====
+	// arms counter this much of the camera bob / nod / roll, so they lag behind it
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Bodycam|Arms")
+	float PivotFollow = 0.35f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Bodycam|Arms")
+	float BobSwayPitchDeg = 1.2f;
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Bodycam|Arms")
+	float BobSwayYawDeg = 0.8f;
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Bodycam|Arms")
+	float BobSwayRollDeg = 1.5f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Bodycam|Arms")
+	float BreathSway = 0.4f;          // cm at full breathing
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Bodycam|Arms")
+	float LandingDipScale = 0.6f;     // extra dip on top of the camera's
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Bodycam|Arms")
+	float KickPitchScale = 0.5f;      // of the flashlight jump / land kick
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Bodycam|Arms")
+	float SprintPitchDeg = 12.f;      // arms lowered while sprinting
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Bodycam|Arms")
+	float InterpSpeed = 14.f;
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Bodycam|Arms")
+	float SprintBlendSpeed = 6.f;
+
+private:
+	TWeakObjectPtr<const ABodycamCharacter> Character;
+	TWeakObjectPtr<UBodycamMotionSubsystem> Motion;
+	bool bHasPose = false;
+};
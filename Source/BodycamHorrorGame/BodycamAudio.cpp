@@ -0,0 +1,389 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamAudio.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamCharacter.h"
+#include "BodycamMotionSubsystem.h"
+#include "BodycamProfile.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/AudioComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Sound/SoundBase.h"
+#include "HAL/IConsoleManager.h"
+
+static int32 GBodycamAudioVoices = 16;
+static FAutoConsoleVariableRef CVarBodycamAudioVoices(
+	TEXT("bodycam.Audio.Voices"),
+	GBodycamAudioVoices,
+	TEXT("Pooled audio components for footsteps and landings (read when the world begins play)."));
+
+static int32 GBodycamAudioBreathVoices = 4;
+static FAutoConsoleVariableRef CVarBodycamAudioBreathVoices(
+	TEXT("bodycam.Audio.BreathVoices"),
+	GBodycamAudioBreathVoices,
+	TEXT("Breathing loops, given to the pawns closest to a listener (read when the world begins play)."));
+
+static float GBodycamAudioMaxDistance = 3000.f;
+static FAutoConsoleVariableRef CVarBodycamAudioMaxDistance(
+	TEXT("bodycam.Audio.MaxDistance"),
+	GBodycamAudioMaxDistance,
+	TEXT("Footsteps farther than this (cm) from every listener are not traced or played."));
+
+static int32 GBodycamAudioMaxTraces = 24;
+static FAutoConsoleVariableRef CVarBodycamAudioMaxTraces(
+	TEXT("bodycam.Audio.MaxTraces"),
+	GBodycamAudioMaxTraces,
+	TEXT("Surface traces per frame; footsteps beyond this play the default footstep."));
+
+namespace BodycamAudio
+{
+	static constexpr float TraceDepth = 60.f;           // cm below the capsule bottom
+	static constexpr float BreathMaxDistance = 1500.f;  // cm
+	static constexpr double MaxOneShotSeconds = 3.0;    // voice stays reserved at most this long
+	static constexpr int32 PendingPerVoice = 2;         // queued footsteps per frame, per one-shot voice
+}
+
+// ---------------------------------------------------------------------------------------------
+
+void FBodycamVoicePool::Reset(int32 NumVoices)
+{
+	Voices.Reset();
+	Voices.SetNum(FMath::Max(0, NumVoices));
+	NumAcquired = 0;
+	NumSteals = 0;
+	NumDropped = 0;
+}
+
+int32 FBodycamVoicePool::Acquire(float Priority, double Now, double Duration)
+{
+	// first free voice, else the least important (oldest on ties)
+	int32 Best = INDEX_NONE;
+	for (int32 v = 0; v < Voices.Num(); ++v)
+	{
+		const FVoice& Voice = Voices[v];
+		if (Voice.EndTime <= Now)
+		{
+			Best = v;
+			break;
+		}
+		if (Best == INDEX_NONE || Voice.Priority < Voices[Best].Priority
+			|| (Voice.Priority == Voices[Best].Priority && Voice.StartTime < Voices[Best].StartTime))
+		{
+			Best = v;
+		}
+	}
+
+	if (Best == INDEX_NONE || (Voices[Best].EndTime > Now && Voices[Best].Priority > Priority))
+	{
+		++NumDropped;
+		return INDEX_NONE;
+	}
+	if (Voices[Best].EndTime > Now)
+	{
+		++NumSteals;
+	}
+
+	++NumAcquired;
+	FVoice& Voice = Voices[Best];
+	Voice.StartTime = Now;
+	Voice.EndTime   = Now + FMath::Max(0.0, Duration);
+	Voice.Priority  = Priority;
+	return Best;
+}
+
+// ---------------------------------------------------------------------------------------------
+
+// every local player's camera (splitscreen has several)
+void UBodycamAudioSubsystem::GetListeners(FListeners& OutListeners) const
+{
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController() && PC->PlayerCameraManager)
+		{
+			OutListeners.Add(PC->PlayerCameraManager->GetCameraLocation());
+		}
+	}
+}
+
+// no listener (headless): everything counts as close, so the pool still gets exercised
+float UBodycamAudioSubsystem::NearestDistSq(const FListeners& Listeners, const FVector& Location)
+{
+	float Best = Listeners.Num() > 0 ? UE_MAX_FLT : 0.f;
+	for (const FVector& Listener : Listeners)
+	{
+		Best = FMath::Min(Best, (float)FVector::DistSquared(Listener, Location));
+	}
+	return Best;
+}
+
+bool UBodycamAudioSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && !IsRunningDedicatedServer();
+}
+
+void UBodycamAudioSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// every component this subsystem will ever play on, created up front
+	Pool.Reset(FMath::Max(1, GBodycamAudioVoices));
+	OneShotVoices.Reset(Pool.Num());
+	for (int32 v = 0; v < Pool.Num(); ++v)
+	{
+		OneShotVoices.Add(CreateVoice(InWorld, TEXT("BodycamStepVoice")));
+	}
+
+	const int32 NumBreath = FMath::Max(0, GBodycamAudioBreathVoices);
+	BreathVoices.Reset(NumBreath);
+	BreathAssignments.SetNum(NumBreath);
+	for (int32 v = 0; v < NumBreath; ++v)
+	{
+		BreathVoices.Add(CreateVoice(InWorld, TEXT("BodycamBreathVoice")));
+	}
+
+	// more footfalls in one frame than this could never all get a voice; the quietest are dropped
+	MaxPendingSteps = Pool.Num() * BodycamAudio::PendingPerVoice;
+	PendingSteps.Reserve(MaxPendingSteps);
+}
+
+UAudioComponent* UBodycamAudioSubsystem::CreateVoice(UWorld& InWorld, const TCHAR* Name)
+{
+	UAudioComponent* Comp = NewObject<UAudioComponent>(&InWorld, MakeUniqueObjectName(&InWorld, UAudioComponent::StaticClass(), Name));
+	Comp->bAutoActivate = false;
+	Comp->bAutoDestroy = false;
+	Comp->bAllowSpatialization = true;
+	Comp->bStopWhenOwnerDestroyed = false;
+	Comp->RegisterComponentWithWorld(&InWorld);
+	return Comp;
+}
+
+void UBodycamAudioSubsystem::Deinitialize()
+{
+	for (UAudioComponent* Comp : OneShotVoices)
+	{
+		if (Comp) Comp->DestroyComponent();
+	}
+	for (UAudioComponent* Comp : BreathVoices)
+	{
+		if (Comp) Comp->DestroyComponent();
+	}
+	OneShotVoices.Reset();
+	BreathVoices.Reset();
+	BreathAssignments.Reset();
+	PendingSteps.Reset();
+
+	Super::Deinitialize();
+}
+
+void UBodycamAudioSubsystem::PlayOneShot(USoundBase* Sound, const FVector& Location, float Volume, float Priority)
+{
+	if (!Sound || OneShotVoices.Num() == 0)
+	{
+		return;
+	}
+
+	const int32 PrevSteals = Pool.GetNumSteals();
+	const double Now = GetWorld()->GetAudioTimeSeconds();
+	const int32 Voice = Pool.Acquire(Priority, Now, FMath::Min((double)Sound->GetDuration(), BodycamAudio::MaxOneShotSeconds));
+	if (Voice == INDEX_NONE)
+	{
+		return;
+	}
+	INC_DWORD_STAT_BY(STAT_BodycamVoiceSteals, Pool.GetNumSteals() - PrevSteals);
+
+	UAudioComponent* Comp = OneShotVoices[Voice];
+	Comp->Stop();
+	Comp->SetSound(Sound);
+	Comp->SetWorldLocation(Location);
+	Comp->SetVolumeMultiplier(Volume);
+	Comp->Play();
+}
+
+void UBodycamAudioSubsystem::PlayPendingSteps()
+{
+	UWorld* World = GetWorld();
+	for (const FPendingStep& Step : PendingSteps)
+	{
+		const ABodycamCharacter* Pawn = Step.Pawn.Get();
+		if (!Pawn)
+		{
+			continue;
+		}
+
+		EPhysicalSurface Surface = SurfaceType_Default;
+		FVector Location = Step.Location;
+		FTraceDatum Datum;
+		if (Step.Handle.IsValid() && World->QueryTraceData(Step.Handle, Datum))
+		{
+			if (const FHitResult* Hit = FHitResult::GetFirstBlockingHit(Datum.OutHits))
+			{
+				Surface  = UPhysicalMaterial::DetermineSurfaceType(Hit->PhysMaterial.Get());
+				Location = Hit->ImpactPoint;
+			}
+		}
+
+		PlayOneShot(UBodycamProfile::GetAudio(Pawn->GetProfile()).GetFootstep(Surface), Location, Step.Volume, Step.Priority);
+	}
+	PendingSteps.Reset();
+}
+
+void UBodycamAudioSubsystem::QueueSteps(const FListeners& Listeners)
+{
+	UWorld* World = GetWorld();
+	const UBodycamMotionSubsystem* Motion = World->GetSubsystem<UBodycamMotionSubsystem>();
+	if (!Motion || Motion->GetFrameEventsFrame() != GFrameCounter)
+	{
+		return;
+	}
+
+	const float MaxDistSq = FMath::Square(GBodycamAudioMaxDistance);
+	int32 NumTraces = 0;
+	for (const FBodycamMotionEvent& Event : Motion->GetFrameEvents())
+	{
+		ABodycamCharacter* Pawn = Event.Pawn;
+		const float HalfHeight = Pawn->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+		const FVector Center = Pawn->GetActorLocation();
+		const FVector Feet = Center - FVector(0.f, 0.f, HalfHeight);
+
+		const float DistSq = NearestDistSq(Listeners, Feet);
+		if (DistSq > MaxDistSq)
+		{
+			continue;
+		}
+		INC_DWORD_STAT(STAT_BodycamFootsteps);
+
+		// closer and louder wins a voice
+		const FBodycamAudio& Audio = UBodycamProfile::GetAudio(Pawn->GetProfile());
+		const float Volume = Event.bLanding ? Audio.LandingVolume : Audio.FootstepVolume * FMath::Clamp(Event.Strength, 0.3f, 1.3f);
+		const float Priority = Volume * (1.f - FMath::Sqrt(DistSq) / FMath::Max(1.f, GBodycamAudioMaxDistance));
+
+		// landings do not care about the surface
+		if (Event.bLanding)
+		{
+			PlayOneShot(Audio.Landing, Feet, Volume, Priority);
+			continue;
+		}
+
+		int32 Slot = PendingSteps.Num();
+		if (Slot >= MaxPendingSteps)
+		{
+			// full (a crowd stepping together): replace the least important queued step, if it is less important than this one
+			Slot = INDEX_NONE;
+			for (int32 p = 0; p < PendingSteps.Num(); ++p)
+			{
+				if (PendingSteps[p].Priority < Priority && (Slot == INDEX_NONE || PendingSteps[p].Priority < PendingSteps[Slot].Priority))
+				{
+					Slot = p;
+				}
+			}
+			if (Slot == INDEX_NONE)
+			{
+				continue;
+			}
+			PendingSteps[Slot] = FPendingStep();
+		}
+		else
+		{
+			PendingSteps.AddDefaulted();
+		}
+
+		FPendingStep& Step = PendingSteps[Slot];
+		Step.Pawn     = Pawn;
+		Step.Location = Feet;
+		Step.Volume   = Volume;
+		Step.Priority = Priority;
+		if (NumTraces < GBodycamAudioMaxTraces)
+		{
+			FCollisionQueryParams Params(SCENE_QUERY_STAT(BodycamFootstep), false, Pawn);
+			Params.bReturnPhysicalMaterial = true;
+			Step.Handle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Center, Feet - FVector(0.f, 0.f, BodycamAudio::TraceDepth), ECC_Visibility, Params);
+			++NumTraces;
+		}
+	}
+}
+
+void UBodycamAudioSubsystem::UpdateBreathing(const FListeners& Listeners)
+{
+	const UBodycamMotionSubsystem* Motion = GetWorld()->GetSubsystem<UBodycamMotionSubsystem>();
+	if (!Motion || BreathVoices.Num() == 0)
+	{
+		return;
+	}
+
+	// candidates: pawns with a breathing loop near a listener, closest first
+	const float MaxDistSq = FMath::Square(BodycamAudio::BreathMaxDistance);
+	BreathScratch.Reset();
+	for (ABodycamCharacter* Pawn : Motion->GetPawns())
+	{
+		const float DistSq = NearestDistSq(Listeners, Pawn->GetActorLocation());
+		if (DistSq <= MaxDistSq && UBodycamProfile::GetAudio(Pawn->GetProfile()).BreathingLoop)
+		{
+			BreathScratch.Add({ Pawn, DistSq });
+		}
+	}
+	BreathScratch.Sort([](const FBreathVoice& A, const FBreathVoice& B) { return A.DistSq < B.DistSq; });
+	const int32 NumBreathing = FMath::Min(BreathScratch.Num(), BreathVoices.Num());
+
+	// voices keep their pawn while it stays among the closest, so loops do not restart
+	for (int32 v = 0; v < BreathVoices.Num(); ++v)
+	{
+		FBreathVoice& Assigned = BreathAssignments[v];
+		bool bKeep = false;
+		for (int32 c = 0; c < NumBreathing && !bKeep; ++c)
+		{
+			bKeep = Assigned.Pawn.IsValid() && BreathScratch[c].Pawn == Assigned.Pawn;
+		}
+		if (!bKeep && (Assigned.Pawn.IsValid() || BreathVoices[v]->IsPlaying()))
+		{
+			Assigned.Pawn.Reset();
+			BreathVoices[v]->Stop();
+		}
+	}
+
+	for (int32 c = 0; c < NumBreathing; ++c)
+	{
+		ABodycamCharacter* Pawn = BreathScratch[c].Pawn.Get();
+		const FBodycamAudio& Audio = UBodycamProfile::GetAudio(Pawn->GetProfile());
+
+		int32 Voice = BreathAssignments.IndexOfByPredicate([Pawn](const FBreathVoice& A) { return A.Pawn == Pawn; });
+		if (Voice == INDEX_NONE)
+		{
+			Voice = BreathAssignments.IndexOfByPredicate([](const FBreathVoice& A) { return !A.Pawn.IsValid(); });
+			BreathAssignments[Voice].Pawn = Pawn;
+
+			UAudioComponent* Comp = BreathVoices[Voice];
+			Comp->AttachToComponent(Pawn->GetCameraPivot(), FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+			Comp->SetSound(Audio.BreathingLoop);
+			Comp->Play();
+		}
+		BreathVoices[Voice]->SetVolumeMultiplier(Audio.BreathVolume * Motion->GetBreathLevel(Pawn));
+	}
+}
+
+void UBodycamAudioSubsystem::Tick(float DeltaTime)
+{
+	BODYCAM_SCOPE(STAT_BodycamAudio, BodycamAudio);
+
+	FListeners Listeners;
+	GetListeners(Listeners);
+
+	// last frame's traces are back; then this frame's footfalls (the motion update ran in TG_PostPhysics)
+	PlayPendingSteps();
+	QueueSteps(Listeners);
+	UpdateBreathing(Listeners);
+}
+
+TStatId UBodycamAudioSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBodycamAudioSubsystem, STATGROUP_Bodycam);
+}
+
+bool UBodycamAudioSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
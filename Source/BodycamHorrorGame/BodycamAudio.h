@@ -0,0 +1,133 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "BodycamAudio.generated.h"
+
+class ABodycamCharacter;
+class UAudioComponent;
+class USoundBase;
+
+/**
+ * Footfalls on the bob phase: sin(2*pi*BobTime) drives the vertical bob, and a foot lands each
+ * time it goes down through zero (BobTime crossing k + 0.5). BobTime resets to 0 when the pawn
+ * stops, which never counts as a step.
+ */
+struct FBodycamFootfall
+{
+	static bool Crossed(float PrevBobTime, float NewBobTime)
+	{
+		return NewBobTime > PrevBobTime && FMath::FloorToInt(NewBobTime - 0.5f) != FMath::FloorToInt(PrevBobTime - 0.5f);
+	}
+};
+
+/**
+ * Voice allocation for a fixed set of one-shot audio components, kept free of the world so it
+ * can be fed synthetic events. A free voice is used first; when all are busy, the lowest
+ * priority voice (oldest on ties) is stolen if the new sound is at least as important.
+ */
+struct BODYCAMHORRORGAME_API FBodycamVoicePool
+{
+	explicit FBodycamVoicePool(int32 NumVoices = 0) { Reset(NumVoices); }
+
+	void Reset(int32 NumVoices);
+
+	/** Voice to play on, or INDEX_NONE when every voice is busy with something more important. */
+	int32 Acquire(float Priority, double Now, double Duration);
+
+	bool IsBusy(int32 Voice, double Now) const { return Voices[Voice].EndTime > Now; }
+	int32 Num() const { return Voices.Num(); }
+
+	// since the last Reset
+	int32 GetNumAcquired() const { return NumAcquired; }
+	int32 GetNumSteals() const { return NumSteals; }
+	int32 GetNumDropped() const { return NumDropped; }
+
+private:
+	struct FVoice
+	{
+		double StartTime = 0.0;
+		double EndTime = 0.0;
+		float Priority = 0.f;
+	};
+
+	TArray<FVoice> Voices;
+	int32 NumAcquired = 0;
+	int32 NumSteals = 0;
+	int32 NumDropped = 0;
+};
+
+/**
+ * Footstep, landing and breathing sounds for every bodycam pawn. Footfalls and landings come
+ * from UBodycamMotionSubsystem's frame events; each gets a batched async downward trace for the
+ * surface and plays a frame later on a pooled audio component. Breathing loops follow the motion
+ * subsystem's breath level on the closest pawns. Components are created once per world; nothing
+ * is spawned per step. Sounds come from the pawn's UBodycamProfile.
+ */
+UCLASS()
+class BODYCAMHORRORGAME_API UBodycamAudioSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	const FBodycamVoicePool& GetVoicePool() const { return Pool; }
+	int32 GetNumVoiceComponents() const { return OneShotVoices.Num() + BreathVoices.Num(); }
+
+	int32 GetNumBreathVoices() const { return BreathAssignments.Num(); }
+
+	/** Pawn a breathing loop is playing for, or null. */
+	const ABodycamCharacter* GetBreathingPawn(int32 Voice) const { return BreathAssignments[Voice].Pawn.Get(); }
+
+	// UTickableWorldSubsystem
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FPendingStep
+	{
+		FTraceHandle Handle;
+		TWeakObjectPtr<ABodycamCharacter> Pawn;
+		FVector Location = FVector::ZeroVector;
+		float Volume = 1.f;
+		float Priority = 0.f;
+	};
+
+	struct FBreathVoice
+	{
+		TWeakObjectPtr<ABodycamCharacter> Pawn;
+		float DistSq = 0.f;
+	};
+
+	using FListeners = TArray<FVector, TInlineAllocator<4>>;
+
+	void GetListeners(FListeners& OutListeners) const;
+	static float NearestDistSq(const FListeners& Listeners, const FVector& Location);
+
+	UAudioComponent* CreateVoice(UWorld& InWorld, const TCHAR* Name);
+	void PlayPendingSteps();
+	void QueueSteps(const FListeners& Listeners);
+	void UpdateBreathing(const FListeners& Listeners);
+	void PlayOneShot(USoundBase* Sound, const FVector& Location, float Volume, float Priority);
+
+	FBodycamVoicePool Pool;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAudioComponent>> OneShotVoices;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAudioComponent>> BreathVoices;
+
+	TArray<FBreathVoice> BreathAssignments;
+	TArray<FPendingStep> PendingSteps;
+	int32 MaxPendingSteps = 0;
+	TArray<FBreathVoice> BreathScratch;
+};
@@ -0,0 +1,247 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamAudioCommandlet.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamAudio.h"
+#include "BodycamBenchmarkCommandlet.h"
+#include "BodycamCommandletTest.h"
+#include "BodycamCharacter.h"
+#include "BodycamMotionSubsystem.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/AudioComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Sound/SoundWave.h"
+#include "UObject/UObjectIterator.h"
+
+namespace BodycamAudioTest
+{
+	static constexpr float Dt = 1.f / 60.f;
+	static constexpr float PawnSpacing = 300.f;
+	static constexpr int32 Cycles = 50;
+	static constexpr double Duration = 10.0; // longer than any test below, so voices stay busy
+
+	// world test sounds: a step lasts long enough that a crowd oversubscribes the pool
+	static constexpr float StepSeconds = 1.f;
+	static constexpr float LandingSeconds = 1.5f;
+
+	static USoundWave* MakeSound(float Seconds, bool bLooping)
+	{
+		USoundWave* Sound = NewObject<USoundWave>(GetTransientPackage(), NAME_None, RF_Transient);
+		Sound->Duration = Seconds;
+		Sound->bLooping = bLooping;
+		return Sound;
+	}
+}
+
+UBodycamAudioCommandlet::UBodycamAudioCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UBodycamAudioCommandlet::Main(const FString& Params)
+{
+	int32 NumPawns = 64;
+	int32 Frames = 600;
+	FParse::Value(*Params, TEXT("Pawns="), NumPawns);
+	FParse::Value(*Params, TEXT("Frames="), Frames);
+
+	int32 Failures = RunFootfall();
+	Failures += RunVoicePool();
+	Failures += RunWorld(FMath::Max(1, NumPawns), FMath::Max(1, Frames));
+
+	if (Failures > 0)
+	{
+		UE_LOG(LogBodycam, Error, TEXT("Audio: %d check(s) failed"), Failures);
+		return 1;
+	}
+	UE_LOG(LogBodycam, Display, TEXT("Audio: all checks passed"));
+	return 0;
+}
+
+int32 UBodycamAudioCommandlet::RunFootfall()
+{
+	using namespace BodycamAudioTest;
+
+	int32 Failures = 0;
+
+	// cadence (bob cycles per second) x frame time, from a slow walk at 30 fps to a sprint at 144 fps
+	const float Cadences[] = { 1.1f, 1.9f, 2.7f };
+	const float FrameTimes[] = { 1.f / 30.f, 1.f / 60.f, 1.f / 144.f };
+	bool bAllExact = true;
+	for (const float Cadence : Cadences)
+	{
+		for (const float FrameTime : FrameTimes)
+		{
+			int32 Steps = 0;
+			float BobTime = 0.f;
+			while (BobTime < Cycles)
+			{
+				const float Next = FMath::Min(BobTime + Cadence * FrameTime, (float)Cycles);
+				Steps += FBodycamFootfall::Crossed(BobTime, Next) ? 1 : 0;
+				BobTime = Next;
+			}
+			if (Steps != Cycles)
+			{
+				UE_LOG(LogBodycam, Display, TEXT("  %.1f Hz at %.1f ms: %d steps over %d cycles"), Cadence, FrameTime * 1000.f, Steps, Cycles);
+				bAllExact = false;
+			}
+		}
+	}
+	BODYCAM_CHECK(bAllExact, "one step per bob cycle at every cadence and frame rate");
+	BODYCAM_CHECK(!FBodycamFootfall::Crossed(0.7f, 0.f), "stopping (bob time reset) is no step");
+	BODYCAM_CHECK(!FBodycamFootfall::Crossed(0.1f, 0.4f), "the rising half of a cycle is no step");
+	BODYCAM_CHECK(FBodycamFootfall::Crossed(0.45f, 0.55f), "the foot lands at half a cycle");
+	return Failures;
+}
+
+int32 UBodycamAudioCommandlet::RunVoicePool()
+{
+	using namespace BodycamAudioTest;
+
+	int32 Failures = 0;
+	FBodycamVoicePool Pool(4);
+
+	// fill it: priorities 0.5, 0.2, 0.8, 0.2 started at t = 0..3
+	const float Fill[] = { 0.5f, 0.2f, 0.8f, 0.2f };
+	bool bFilledInOrder = true;
+	for (int32 v = 0; v < (int32)UE_ARRAY_COUNT(Fill); ++v)
+	{
+		bFilledInOrder &= Pool.Acquire(Fill[v], v, Duration) == v;
+	}
+	BODYCAM_CHECK(bFilledInOrder && Pool.GetNumSteals() == 0, "free voices are used first, without steals");
+
+	BODYCAM_CHECK(Pool.Acquire(0.3f, 4.0, Duration) == 1, "a full pool steals the least important voice, oldest first");
+	BODYCAM_CHECK(Pool.Acquire(0.1f, 5.0, Duration) == INDEX_NONE, "a request less important than every busy voice is dropped");
+	BODYCAM_CHECK(Pool.Acquire(0.2f, 6.0, Duration) == 3, "an equally important request steals");
+	BODYCAM_CHECK(Pool.Acquire(0.25f, 7.0, Duration) == 3, "a voice stolen at low priority is the next to go");
+	BODYCAM_CHECK(Pool.GetNumAcquired() == 7 && Pool.GetNumSteals() == 3 && Pool.GetNumDropped() == 1, "acquisitions, steals and drops are counted");
+
+	// voice 0 ends at t = 10
+	BODYCAM_CHECK(Pool.Acquire(0.f, 10.5, Duration) == 0 && Pool.GetNumSteals() == 3, "a finished voice is reused without a steal");
+	BODYCAM_CHECK(Pool.IsBusy(0, 11.0) && !Pool.IsBusy(2, 12.5), "voices are busy for their duration");
+
+	FBodycamVoicePool Empty(0);
+	BODYCAM_CHECK(Empty.Acquire(1.f, 0.0, Duration) == INDEX_NONE && Empty.GetNumDropped() == 1, "an empty pool drops everything");
+	return Failures;
+}
+
+int32 UBodycamAudioCommandlet::RunWorld(int32 NumPawns, int32 Frames)
+{
+	using namespace BodycamAudioTest;
+
+	int32 Failures = 0;
+	UWorld* World = UBodycamBenchmarkCommandlet::CreateBenchmarkWorld(TEXT("BodycamAudio"));
+	const UBodycamAudioSubsystem* Audio = World ? World->GetSubsystem<UBodycamAudioSubsystem>() : nullptr;
+	const UBodycamMotionSubsystem* Motion = World ? World->GetSubsystem<UBodycamMotionSubsystem>() : nullptr;
+	if (!Audio || !Motion)
+	{
+		UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+		UE_LOG(LogBodycam, Error, TEXT("FAILED: could not create the test world with its audio subsystem"));
+		return 1;
+	}
+
+	auto CountAudioComponents = [World]()
+	{
+		int32 Count = 0;
+		for (TObjectIterator<UAudioComponent> It; It; ++It)
+		{
+			Count += (It->GetWorld() == World && !It->IsBeingDestroyed()) ? 1 : 0;
+		}
+		return Count;
+	};
+
+	// every pawn gets real (if silent) sounds, or the subsystem never touches its voices
+	UBodycamProfile* Profile = NewObject<UBodycamProfile>(GetTransientPackage(), NAME_None, RF_Transient);
+	Profile->Audio.Footstep      = MakeSound(StepSeconds, false);
+	Profile->Audio.Landing       = MakeSound(LandingSeconds, false);
+	Profile->Audio.BreathingLoop = MakeSound(2.f, true);
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	// a listener at one corner of the grid (it follows the crowd), so distance decides priorities and breathing
+	const FVector ListenerOffset(-PawnSpacing, -PawnSpacing, 70.f);
+	APlayerController* Listener = World->SpawnActor<APlayerController>(APlayerController::StaticClass(), ListenerOffset, FRotator::ZeroRotator, SpawnParams);
+	const bool bHasListener = Listener && Listener->PlayerCameraManager;
+
+	TArray<ABodycamCharacter*> Pawns;
+	const int32 Side = FMath::CeilToInt(FMath::Sqrt((float)NumPawns));
+	for (int32 i = 0; i < NumPawns; ++i)
+	{
+		const FVector Loc((i % Side) * PawnSpacing, (i / Side) * PawnSpacing, 100.f);
+		if (ABodycamCharacter* Pawn = World->SpawnActor<ABodycamCharacter>(ABodycamCharacter::StaticClass(), Loc, FRotator::ZeroRotator, SpawnParams))
+		{
+			Pawn->GetCharacterMovement()->bRunPhysicsWithNoController = true;
+			Pawn->SetProfile(Profile);
+			Pawns.Add(Pawn);
+		}
+	}
+
+	// after one frame everything that exists up front does
+	World->Tick(LEVELTICK_All, Dt);
+	++GFrameCounter;
+	const int32 ComponentsBefore = CountAudioComponents();
+
+	int32 NumFootfalls = 0;
+	for (int32 Frame = 0; Frame < Frames; ++Frame)
+	{
+		for (int32 i = 0; i < Pawns.Num(); ++i)
+		{
+			UBodycamBenchmarkCommandlet::DriveSyntheticInput(Pawns[i], i, Frame, Dt);
+		}
+		if (bHasListener && Pawns.Num() > 0)
+		{
+			// the camera views the controller itself: its location is the listener
+			Listener->SetActorLocation(Pawns[0]->GetActorLocation() + ListenerOffset);
+			Listener->PlayerCameraManager->UpdateCamera(0.f);
+		}
+		World->Tick(LEVELTICK_All, Dt);
+		++GFrameCounter;
+		NumFootfalls += Motion->GetFrameEvents().Num();
+	}
+	const int32 ComponentsAfter = CountAudioComponents();
+
+	// breathing goes to the pawns closest to the listener (as of the last audio update)
+	const FVector ListenerNow = bHasListener ? Listener->PlayerCameraManager->GetCameraLocation() : FVector::ZeroVector;
+	TArray<const ABodycamCharacter*> Closest;
+	for (const ABodycamCharacter* Pawn : Pawns)
+	{
+		Closest.Add(Pawn);
+	}
+	Closest.Sort([&ListenerNow](const ABodycamCharacter& A, const ABodycamCharacter& B)
+	{
+		return FVector::DistSquared(A.GetActorLocation(), ListenerNow) < FVector::DistSquared(B.GetActorLocation(), ListenerNow);
+	});
+	const int32 NumBreath = Audio->GetNumBreathVoices();
+	int32 NumBreathing = 0;
+	bool bBreathClosest = true;
+	for (int32 v = 0; v < NumBreath; ++v)
+	{
+		if (const ABodycamCharacter* Pawn = Audio->GetBreathingPawn(v))
+		{
+			++NumBreathing;
+			bBreathClosest &= Closest.IndexOfByKey(Pawn) < NumBreath;
+		}
+	}
+
+	const FBodycamVoicePool& Pool = Audio->GetVoicePool();
+	UE_LOG(LogBodycam, Display, TEXT("  %d footfalls / landings, %d voices acquired, %d steals, %d dropped, %d/%d breathing, %d audio components before, %d after"),
+		NumFootfalls, Pool.GetNumAcquired(), Pool.GetNumSteals(), Pool.GetNumDropped(), NumBreathing, NumBreath, ComponentsBefore, ComponentsAfter);
+	BODYCAM_CHECK(bHasListener, "the listener has a camera");
+	BODYCAM_CHECK(NumFootfalls > 0, "walking pawns produce footfalls");
+	BODYCAM_CHECK(Audio->GetNumVoiceComponents() > 0 && Pool.Num() > 0, "the voices exist from begin play");
+	BODYCAM_CHECK(Pool.GetNumAcquired() > 0, "footsteps and landings play on pooled voices");
+	BODYCAM_CHECK(Pawns.Num() <= Pool.Num() || Pool.GetNumSteals() > 0, "an oversubscribed pool steals voices");
+	BODYCAM_CHECK(NumBreath == 0 || NumBreathing > 0, "pawns near the listener breathe");
+	BODYCAM_CHECK(bBreathClosest, "breathing loops go to the pawns closest to the listener");
+	BODYCAM_CHECK(ComponentsAfter == ComponentsBefore, "no audio components are created while stepping");
+
+	UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+	return Failures;
+}
@@ -0,0 +1,38 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BodycamAudioCommandlet.generated.h"
+
+/**
+ * Headless checks for the bodycam audio logic.
+ *
+ *   UnrealEditor-Cmd BodycamHorrorGame -run=BodycamAudio -nullrhi -unattended [-Pawns=64] [-Frames=600]
+ *
+ * Footfall: synthetic bob phases at several cadences and frame rates give exactly one step per
+ * bob cycle, and a stop (BobTime back to 0) is no step. Voice pool: a full pool steals the
+ * least important voice (oldest on ties), drops requests less important than every busy voice,
+ * and reuses a finished voice without stealing. World: -Pawns walking pawns with a transient
+ * profile (silent sound waves with real durations) and one listener at a corner of the grid,
+ * for -Frames frames: footfalls play on pooled voices, the oversubscribed pool steals, the
+ * breathing loops sit on the pawns closest to the listener, and no audio components are created
+ * after begin play.
+ * Returns non-zero when a check fails.
+ */
+UCLASS()
+class UBodycamAudioCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBodycamAudioCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	int32 RunFootfall();
+	int32 RunVoicePool();
+	int32 RunWorld(int32 NumPawns, int32 Frames);
+};
@@ -0,0 +1,378 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamBenchmarkCommandlet.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamCharacter.h"
+#include "BodycamMotionSubsystem.h"
+#include "BodycamNoiseBank.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "Components/StaticMeshComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/IConsoleManager.h"
+
+namespace BodycamBenchmark
+{
+	static constexpr float FixedDeltaSeconds = 1.f / 60.f;
+	static constexpr float PawnSpacing = 300.f;
+
+	struct FSummary
+	{
+		float Mean = 0.f, P50 = 0.f, P90 = 0.f, P99 = 0.f, Max = 0.f;
+	};
+
+	static FSummary Summarize(TArray<float> Samples)
+	{
+		FSummary S;
+		if (Samples.Num() == 0)
+		{
+			return S;
+		}
+		Samples.Sort();
+
+		double Sum = 0.0;
+		for (float V : Samples) Sum += V;
+
+		auto Percentile = [&Samples](float P)
+		{
+			const int32 Idx = FMath::Clamp(FMath::CeilToInt(P * Samples.Num()) - 1, 0, Samples.Num() - 1);
+			return Samples[Idx];
+		};
+
+		S.Mean = (float)(Sum / Samples.Num());
+		S.P50  = Percentile(0.50f);
+		S.P90  = Percentile(0.90f);
+		S.P99  = Percentile(0.99f);
+		S.Max  = Samples.Last();
+		return S;
+	}
+}
+
+UBodycamBenchmarkCommandlet::UBodycamBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UBodycamBenchmarkCommandlet::Main(const FString& Params)
+{
+	TArray<int32> Counts = { 1, 10, 100, 1000 };
+	FString CountsStr;
+	if (FParse::Value(*Params, TEXT("Counts="), CountsStr))
+	{
+		TArray<FString> Parts;
+		CountsStr.ParseIntoArray(Parts, TEXT(","));
+		Counts.Reset();
+		for (const FString& Part : Parts)
+		{
+			Counts.Add(FMath::Max(1, FCString::Atoi(*Part)));
+		}
+	}
+
+	int32 Frames = 600;
+	int32 WarmupFrames = 60;
+	FParse::Value(*Params, TEXT("Frames="), Frames);
+	FParse::Value(*Params, TEXT("Warmup="), WarmupFrames);
+
+	FString OutDir = FPaths::ProjectSavedDir() / TEXT("Profiling/Bodycam");
+	FParse::Value(*Params, TEXT("Out="), OutDir);
+
+	// nobody views the benchmark pawns; by default step them every frame like a viewed pawn
+	float UnviewedRate = -1.f;
+	FParse::Value(*Params, TEXT("UnviewedRate="), UnviewedRate);
+	if (IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("bodycam.Motion.UnviewedRate")))
+	{
+		CVar->Set(UnviewedRate);
+	}
+
+	bViewer = FParse::Param(*Params, TEXT("Viewer"));
+
+	// timings of a breathing table that does not match the noise it replaces mean nothing
+	const FBodycamNoiseBank& Noise = FBodycamNoiseBank::Get();
+	if (!Noise.IsWithinTolerance())
+	{
+		UE_LOG(LogBodycam, Error, TEXT("Noise bank out of tolerance: max deviation %.5f > %.5f"), Noise.GetMaxDeviation(), FBodycamNoiseBank::MaxDeviationTolerance);
+		return 1;
+	}
+
+	TArray<UClass*> Classes = { ABodycamCharacter::StaticClass() };
+	if (FParse::Param(*Params, TEXT("Blueprint")))
+	{
+		if (UClass* BPClass = LoadClass<ABodycamCharacter>(nullptr, TEXT("/Game/BP/BP_BodycamCharacter.BP_BodycamCharacter_C")))
+		{
+			Classes.Add(BPClass);
+		}
+		else
+		{
+			UE_LOG(LogBodycam, Warning, TEXT("BP_BodycamCharacter could not be loaded, benchmarking the native class only"));
+		}
+	}
+
+	TArray<FRun> Runs;
+	for (UClass* PawnClass : Classes)
+	{
+		for (int32 Count : Counts)
+		{
+			FRun& Run = Runs.AddDefaulted_GetRef();
+			if (!RunOne(PawnClass, Count, WarmupFrames, Frames, Run))
+			{
+				UE_LOG(LogBodycam, Error, TEXT("Benchmark run failed (%s x%d)"), *PawnClass->GetName(), Count);
+				return 1;
+			}
+
+			const BodycamBenchmark::FSummary Frame   = BodycamBenchmark::Summarize(Run.FrameMs);
+			const BodycamBenchmark::FSummary Bodycam = BodycamBenchmark::Summarize(Run.BodycamMs);
+			const BodycamBenchmark::FSummary Move    = BodycamBenchmark::Summarize(Run.MovementMs);
+			UE_LOG(LogBodycam, Display, TEXT("%-28s x%-5d frame p50 %.3f ms p99 %.3f | bodycam p50 %.3f ms | movement p50 %.3f ms"),
+				*Run.ClassName, Count, Frame.P50, Frame.P99, Bodycam.P50, Move.P50);
+		}
+	}
+
+	WriteResults(Runs, OutDir);
+	return 0;
+}
+
+UWorld* UBodycamBenchmarkCommandlet::CreateBenchmarkWorld(const TCHAR* Name)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, Name);
+	FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+	Context.SetCurrentWorld(World);
+
+	const FURL URL;
+	World->SetGameMode(URL);
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	// a big flat floor so the pawns can walk
+	if (UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")))
+	{
+		AStaticMeshActor* Floor = World->SpawnActor<AStaticMeshActor>(FVector(0.f, 0.f, -50.f), FRotator::ZeroRotator);
+		Floor->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
+		Floor->GetStaticMeshComponent()->SetStaticMesh(Cube);
+		Floor->SetActorScale3D(FVector(2000.f, 2000.f, 1.f));
+	}
+	return World;
+}
+
+UWorld* UBodycamBenchmarkCommandlet::LoadMapWorld(const FString& MapPath)
+{
+	UPackage* Package = LoadPackage(nullptr, *MapPath, LOAD_None);
+	UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	// loaded worlds are not referenced by anything until the context has them
+	World->WorldType = EWorldType::Game;
+	World->AddToRoot();
+	FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+	Context.SetCurrentWorld(World);
+	World->InitWorld();
+
+	const FURL URL;
+	World->SetGameMode(URL);
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+	return World;
+}
+
+void UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(UWorld* World)
+{
+	if (World)
+	{
+		World->RemoveFromRoot();
+		World->EndPlay(EEndPlayReason::Quit);
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+}
+
+void UBodycamBenchmarkCommandlet::DriveSyntheticInput(ABodycamCharacter* Pawn, int32 PawnIndex, int32 Frame, float DeltaSeconds)
+{
+	// 4 s loop: walk, walk + strafe right, sprint, strafe left with two jumps; pawns are staggered
+	const int32 Phase = (Frame + PawnIndex * 37) % 240;
+
+	FVector2D Axis(0.f, 1.f);
+	bool bSprint = false;
+	if (Phase >= 60 && Phase < 120)
+	{
+		Axis = FVector2D(1.f, 0.5f);
+	}
+	else if (Phase >= 120 && Phase < 180)
+	{
+		bSprint = true;
+	}
+	else if (Phase >= 180)
+	{
+		Axis = FVector2D(-1.f, 0.f);
+		if (Phase == 180 || Phase == 210) Pawn->Jump();
+		if (Phase == 181 || Phase == 211) Pawn->StopJumping();
+	}
+
+	if (Pawn->IsSprinting() != bSprint)
+	{
+		Pawn->SetSprinting(bSprint);
+	}
+
+	// a few small look events per frame, like a high polling rate mouse (exercises the free-aim resolve)
+	const float LookPhase = (Frame + PawnIndex * 13) * DeltaSeconds;
+	for (int32 Event = 0; Event < 4; ++Event)
+	{
+		Pawn->AddLookInput(FVector2f(0.05f * FMath::Sin(LookPhase * 2.f), 0.03f * FMath::Cos(LookPhase * 1.3f)));
+	}
+
+	// slow turn so the pawns stay near the spawn grid
+	Pawn->AddActorWorldRotation(FRotator(0.f, 30.f * DeltaSeconds, 0.f));
+	Pawn->AddMovementInput(Pawn->GetActorForwardVector(), Axis.Y);
+	Pawn->AddMovementInput(Pawn->GetActorRightVector(),   Axis.X);
+}
+
+bool UBodycamBenchmarkCommandlet::RunOne(UClass* PawnClass, int32 NumPawns, int32 WarmupFrames, int32 Frames, FRun& OutRun)
+{
+	UWorld* World = CreateBenchmarkWorld(TEXT("BodycamBenchmark"));
+	if (!World)
+	{
+		return false;
+	}
+
+	OutRun.ClassName = PawnClass->GetName();
+	OutRun.NumPawns = NumPawns;
+
+	// pawns on a grid; movement is ticked by hand below so it can be timed on its own
+	TArray<ABodycamCharacter*> Pawns;
+	TArray<UCharacterMovementComponent*> Movers;
+	const int32 Side = FMath::CeilToInt(FMath::Sqrt((float)NumPawns));
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	for (int32 i = 0; i < NumPawns; ++i)
+	{
+		const FVector Loc((i % Side) * BodycamBenchmark::PawnSpacing, (i / Side) * BodycamBenchmark::PawnSpacing, 100.f);
+		ABodycamCharacter* Pawn = World->SpawnActor<ABodycamCharacter>(PawnClass, Loc, FRotator::ZeroRotator, SpawnParams);
+		if (!Pawn)
+		{
+			continue;
+		}
+		UCharacterMovementComponent* Move = Pawn->GetCharacterMovement();
+		Move->bRunPhysicsWithNoController = true;
+		Move->SetComponentTickEnabled(false);
+		Pawns.Add(Pawn);
+		Movers.Add(Move);
+	}
+
+	// a local player camera at a corner, so the far side of the grid is far and the pawns behind it off-screen
+	if (bViewer)
+	{
+		const float Extent = Side * BodycamBenchmark::PawnSpacing;
+		const FVector ViewLoc(-BodycamBenchmark::PawnSpacing, -BodycamBenchmark::PawnSpacing, 170.f);
+		const FRotator ViewRot = (FVector(Extent * 0.5f, Extent * 0.5f, 100.f) - ViewLoc).Rotation();
+		if (APlayerController* Viewer = World->SpawnActor<APlayerController>(APlayerController::StaticClass(), ViewLoc, ViewRot, SpawnParams))
+		{
+			Viewer->SetControlRotation(ViewRot);
+		}
+	}
+
+	const UBodycamMotionSubsystem* Motion = World->GetSubsystem<UBodycamMotionSubsystem>();
+	const float Dt = BodycamBenchmark::FixedDeltaSeconds;
+
+	for (int32 Frame = 0; Frame < WarmupFrames + Frames; ++Frame)
+	{
+		for (int32 i = 0; i < Pawns.Num(); ++i)
+		{
+			DriveSyntheticInput(Pawns[i], i, Frame, Dt);
+		}
+
+		const double T0 = FPlatformTime::Seconds();
+		for (UCharacterMovementComponent* Move : Movers)
+		{
+			Move->TickComponent(Dt, LEVELTICK_All, &Move->PrimaryComponentTick);
+		}
+		const double T1 = FPlatformTime::Seconds();
+		World->Tick(LEVELTICK_All, Dt);
+		const double T2 = FPlatformTime::Seconds();
+		++GFrameCounter;
+
+		if (Frame < WarmupFrames)
+		{
+			continue;
+		}
+
+		const FBodycamMotionTimings& Timings = Motion ? Motion->GetLastTimings() : FBodycamMotionTimings();
+		OutRun.MovementMs.Add((float)((T1 - T0) * 1000.0));
+		OutRun.BodycamMs.Add((float)(Timings.GetTotalSeconds() * 1000.0));
+		OutRun.BodycamSolveMs.Add((float)(Timings.SolveSeconds * 1000.0));
+		OutRun.WorldTickMs.Add((float)((T2 - T1) * 1000.0));
+		OutRun.FrameMs.Add((float)((T2 - T0) * 1000.0));
+	}
+
+	DestroyBenchmarkWorld(World);
+	return true;
+}
+
+void UBodycamBenchmarkCommandlet::WriteResults(const TArray<FRun>& Runs, const FString& OutDir) const
+{
+	const FString Stamp = FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"));
+	const FString CsvPath  = OutDir / FString::Printf(TEXT("BodycamBenchmark-%s.csv"), *Stamp);
+	const FString JsonPath = OutDir / FString::Printf(TEXT("BodycamBenchmark-%s.json"), *Stamp);
+
+	FString Csv = TEXT("class,pawns,metric,mean,p50,p90,p99,max\n");
+	TArray<TSharedPtr<FJsonValue>> JsonRuns;
+
+	for (const FRun& Run : Runs)
+	{
+		const TPair<const TCHAR*, const TArray<float>*> Metrics[] =
+		{
+			{ TEXT("movement_ms"),      &Run.MovementMs },
+			{ TEXT("bodycam_ms"),       &Run.BodycamMs },
+			{ TEXT("bodycam_solve_ms"), &Run.BodycamSolveMs },
+			{ TEXT("world_tick_ms"),    &Run.WorldTickMs },
+			{ TEXT("frame_ms"),         &Run.FrameMs },
+		};
+
+		TSharedRef<FJsonObject> RunObj = MakeShared<FJsonObject>();
+		RunObj->SetStringField(TEXT("class"), Run.ClassName);
+		RunObj->SetNumberField(TEXT("pawns"), Run.NumPawns);
+		RunObj->SetNumberField(TEXT("frames"), Run.FrameMs.Num());
+
+		TSharedRef<FJsonObject> MetricsObj = MakeShared<FJsonObject>();
+		for (const auto& Metric : Metrics)
+		{
+			const BodycamBenchmark::FSummary S = BodycamBenchmark::Summarize(*Metric.Value);
+			Csv += FString::Printf(TEXT("%s,%d,%s,%.4f,%.4f,%.4f,%.4f,%.4f\n"), *Run.ClassName, Run.NumPawns, Metric.Key, S.Mean, S.P50, S.P90, S.P99, S.Max);
+
+			TSharedRef<FJsonObject> SummaryObj = MakeShared<FJsonObject>();
+			SummaryObj->SetNumberField(TEXT("mean"), S.Mean);
+			SummaryObj->SetNumberField(TEXT("p50"), S.P50);
+			SummaryObj->SetNumberField(TEXT("p90"), S.P90);
+			SummaryObj->SetNumberField(TEXT("p99"), S.P99);
+			SummaryObj->SetNumberField(TEXT("max"), S.Max);
+			MetricsObj->SetObjectField(Metric.Key, SummaryObj);
+		}
+		RunObj->SetObjectField(TEXT("metrics"), MetricsObj);
+		JsonRuns.Add(MakeShared<FJsonValueObject>(RunObj));
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("fixed_delta_seconds"), BodycamBenchmark::FixedDeltaSeconds);
+	Root->SetArrayField(TEXT("runs"), JsonRuns);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Root, Writer);
+
+	FFileHelper::SaveStringToFile(Csv, *CsvPath);
+	FFileHelper::SaveStringToFile(Json, *JsonPath);
+	UE_LOG(LogBodycam, Display, TEXT("Benchmark results written to %s (+ .json)"), *CsvPath);
+}
@@ -0,0 +1,63 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BodycamBenchmarkCommandlet.generated.h"
+
+class ABodycamCharacter;
+
+/**
+ * Headless N-pawn scaling benchmark for ABodycamCharacter.
+ *
+ *   UnrealEditor-Cmd BodycamHorrorGame -run=BodycamBenchmark -nullrhi -unattended
+ *       [-Counts=1,10,100,1000] [-Frames=600] [-Warmup=60] [-Blueprint] [-Out=<dir>] [-UnviewedRate=-1] [-Viewer]
+ *
+ * Spawns each pawn count in a fresh game world on a flat floor, drives the pawns with synthetic
+ * walk / sprint / strafe / jump input at a fixed 60 Hz step, and times CharacterMovement, the
+ * bodycam motion subsystem and the rest of the world tick per frame. -UnviewedRate sets
+ * bodycam.Motion.UnviewedRate for the run (default -1: every pawn steps every frame). -Viewer
+ * adds a player camera at one corner of the grid looking across it, so pawns get rated by
+ * significance like NPCs in a level. Writes CSV and JSON with percentiles to Saved/Profiling/Bodycam.
+ * Returns non-zero when a run fails or the breathing noise bank is out of tolerance
+ * (FBodycamNoiseBank::MaxDeviationTolerance).
+ */
+UCLASS()
+class UBodycamBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBodycamBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	/** Per-frame samples (ms) for one class / pawn count. */
+	struct FRun
+	{
+		FString ClassName;
+		int32 NumPawns = 0;
+		TArray<float> MovementMs;
+		TArray<float> BodycamMs;
+		TArray<float> BodycamSolveMs;
+		TArray<float> WorldTickMs;
+		TArray<float> FrameMs;
+	};
+
+	/** Shared with the other headless drivers: game world with a floor, ready to tick. */
+	static UWorld* CreateBenchmarkWorld(const TCHAR* Name);
+	static void DestroyBenchmarkWorld(UWorld* World);
+
+	/** A map from disk as a game world, begun play; null if it does not load. Destroy with DestroyBenchmarkWorld. */
+	static UWorld* LoadMapWorld(const FString& MapPath);
+
+	/** Synthetic input for one pawn on one frame (walk, strafe, sprint, jump, turn). */
+	static void DriveSyntheticInput(ABodycamCharacter* Pawn, int32 PawnIndex, int32 Frame, float DeltaSeconds);
+
+private:
+	bool RunOne(UClass* PawnClass, int32 NumPawns, int32 WarmupFrames, int32 Frames, FRun& OutRun);
+
+	bool bViewer = false;
+	void WriteResults(const TArray<FRun>& Runs, const FString& OutDir) const;
+};
@@ -0,0 +1,136 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamCameraModifier.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamCharacter.h"
+#include "BodycamMotionSubsystem.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/SpotLightComponent.h"
+#include "GameFramework/PlayerController.h"
+
+UBodycamCameraModifier::UBodycamCameraModifier()
+{
+	// modifiers run in ascending priority; go last so we work on the final view
+	Priority = 250;
+}
+
+void UBodycamCameraModifier::AddTo(APlayerController* PC)
+{
+	if (PC && PC->IsLocalController() && PC->PlayerCameraManager
+		&& !PC->PlayerCameraManager->FindCameraModifierByClass(StaticClass()))
+	{
+		PC->PlayerCameraManager->AddNewCameraModifier(StaticClass());
+	}
+}
+
+void UBodycamCameraModifier::RemoveFrom(APlayerController* PC)
+{
+	if (PC && PC->PlayerCameraManager)
+	{
+		if (UCameraModifier* Modifier = PC->PlayerCameraManager->FindCameraModifierByClass(StaticClass()))
+		{
+			Modifier->DisableModifier(true);
+			PC->PlayerCameraManager->RemoveCameraModifier(Modifier);
+		}
+	}
+}
+
+bool UBodycamCameraModifier::LatchesViewOf(const ABodycamCharacter* Pawn)
+{
+	const APlayerController* PC = Pawn ? Cast<APlayerController>(Pawn->GetController()) : nullptr;
+	if (!PC || !PC->IsLocalController() || !PC->PlayerCameraManager || PC->PlayerCameraManager->GetViewTarget() != Pawn)
+	{
+		return false;
+	}
+	const UCameraModifier* Modifier = PC->PlayerCameraManager->FindCameraModifierByClass(StaticClass());
+	return Modifier && !Modifier->IsDisabled();
+}
+
+bool UBodycamCameraModifier::ModifyCamera(float DeltaTime, FMinimalViewInfo& InOutPOV)
+{
+	BODYCAM_SCOPE(STAT_BodycamCameraModifier, BodycamCameraModifier);
+
+	Super::ModifyCamera(DeltaTime, InOutPOV);
+
+	ABodycamCharacter* Pawn = Cast<ABodycamCharacter>(GetViewTarget());
+	SetDrivenPawn(Pawn);
+
+	UBodycamMotionSubsystem* Motion = Pawn ? Pawn->GetWorld()->GetSubsystem<UBodycamMotionSubsystem>() : nullptr;
+	FBodycamViewPose Pose;
+	if (!Motion || !Motion->GetViewPose(Pawn, Pose))
+	{
+		return false;
+	}
+	Motion->SetViewDriven(Pawn, true);
+
+	// late latch: this frame's resolved look turns the controller only now, right before the view is used
+	if (CameraOwner && Pawn->GetController() == CameraOwner->GetOwningPlayerController())
+	{
+		InOutPOV.Rotation += Pawn->LatchViewRotation(DeltaTime);
+	}
+
+	// bob / breath / landing offset is in capsule space
+	InOutPOV.Location += Pawn->GetActorQuat().RotateVector(FVector(Pose.PivotOffset));
+	InOutPOV.Rotation.Pitch += Pose.Pitch;
+	InOutPOV.Rotation.Roll  += Pose.Roll;
+	InOutPOV.FOV = Pose.FOV;
+
+	// flashlight rides the final view: one world transform update, skipped when it barely moved
+	if (USpotLightComponent* Light = Pawn->GetFlashlight())
+	{
+		const FTransform ViewXf(InOutPOV.Rotation, InOutPOV.Location);
+		const FTransform LightXf = FTransform(FRotator(Pose.LightPitch, Pose.LightYaw, 0.f), FVector(Pose.LightLocation)) * ViewXf;
+
+		const float Threshold = UBodycamMotionSubsystem::GetLightUpdateThreshold();
+		if (!Light->GetComponentLocation().Equals(LightXf.GetLocation(), Threshold)
+			|| !Light->GetComponentQuat().Rotator().Equals(LightXf.Rotator(), Threshold))
+		{
+			Light->SetWorldLocationAndRotation(LightXf.GetLocation(), LightXf.GetRotation());
+			INC_DWORD_STAT(STAT_BodycamTransformsIssued);
+			TRACE_COUNTER_INCREMENT(BodycamTransformsIssued);
+		}
+		else
+		{
+			INC_DWORD_STAT(STAT_BodycamTransformsSkipped);
+			TRACE_COUNTER_INCREMENT(BodycamTransformsSkipped);
+		}
+		if (FBodycamLatencyTracker* Latency = Pawn->GetLatencyTracker())
+		{
+			Latency->Stamp(EBodycamLatencyStage::Flashlight, FPlatformTime::Seconds());
+		}
+	}
+
+	// the view this look input ends up in is done
+	if (FBodycamLatencyTracker* Latency = Pawn->GetLatencyTracker())
+	{
+		Latency->Stamp(EBodycamLatencyStage::View, FPlatformTime::Seconds());
+	}
+
+	return false;
+}
+
+void UBodycamCameraModifier::DisableModifier(bool bImmediate)
+{
+	Super::DisableModifier(bImmediate);
+	SetDrivenPawn(nullptr);
+}
+
+void UBodycamCameraModifier::SetDrivenPawn(ABodycamCharacter* Pawn)
+{
+	ABodycamCharacter* Prev = DrivenPawn.Get();
+	if (Prev == Pawn)
+	{
+		return;
+	}
+
+	// hand the previous view target back to the subsystem's component writes
+	if (Prev)
+	{
+		if (UBodycamMotionSubsystem* Motion = Prev->GetWorld()->GetSubsystem<UBodycamMotionSubsystem>())
+		{
+			Motion->SetViewDriven(Prev, false);
+		}
+	}
+	DrivenPawn = Pawn;
+}
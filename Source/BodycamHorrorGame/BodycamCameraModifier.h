@@ -0,0 +1,44 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Camera/CameraModifier.h"
+#include "BodycamCameraModifier.generated.h"
+
+class ABodycamCharacter;
+class APlayerController;
+
+/**
+ * Applies bodycam bob, breath, roll, landing kick and FOV straight to the final view of a
+ * locally viewed ABodycamCharacter, then places its flashlight with one transform update.
+ * Runs in the camera manager update, after every actor and the motion subsystem have ticked.
+ */
+UCLASS()
+class BODYCAMHORRORGAME_API UBodycamCameraModifier : public UCameraModifier
+{
+	GENERATED_BODY()
+
+public:
+	UBodycamCameraModifier();
+
+	/** Adds the modifier to a local player's camera manager once. */
+	static void AddTo(APlayerController* PC);
+
+	/** Takes the modifier off a player's camera manager, handing its view target back to the subsystem. */
+	static void RemoveFrom(APlayerController* PC);
+
+	/**
+	 * True when the pawn's own local controller views it through an enabled modifier, which then
+	 * latches its look turn. A spectator or another player viewing the pawn does not.
+	 */
+	static bool LatchesViewOf(const ABodycamCharacter* Pawn);
+
+	virtual bool ModifyCamera(float DeltaTime, FMinimalViewInfo& InOutPOV) override;
+	virtual void DisableModifier(bool bImmediate = false) override;
+
+private:
+	void SetDrivenPawn(ABodycamCharacter* Pawn);
+
+	TWeakObjectPtr<ABodycamCharacter> DrivenPawn;
+};
@@ -2,18 +2,73 @@
 
 
 #include "BodycamCharacter.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamAllocGuard.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "InputActionValue.h"
+#include "GameFramework/InputSettings.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
 #include "Components/SpotLightComponent.h"
+#include "BodycamMotionSubsystem.h"
+#include "BodycamCameraModifier.h"
+#include "BodycamFlashlightGovernor.h"
+#include "BodycamInteractionComponent.h"
+#include "BodycamLitQuery.h"
+#include "BodycamPreload.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "InputAction.h"
+#include "InputMappingContext.h"
+#include "Engine/World.h"
+#include "WorldPartition/WorldPartitionSubsystem.h"
+#include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
+
+static float GBodycamNetAimRate = 15.f;
+static FAutoConsoleVariableRef CVarBodycamNetAimRate(
+	TEXT("bodycam.Net.AimRate"),
+	GBodycamNetAimRate,
+	TEXT("Max free-aim updates per second a client sends to the server."));
+
+static float GBodycamNetNearDistance = 1500.f;
+static FAutoConsoleVariableRef CVarBodycamNetNearDistance(
+	TEXT("bodycam.Net.NearDistance"),
+	GBodycamNetNearDistance,
+	TEXT("Pawns closer than this (cm) to a player's view replicate at the full rate."));
+
+static float GBodycamNetFarDistance = 6000.f;
+static FAutoConsoleVariableRef CVarBodycamNetFarDistance(
+	TEXT("bodycam.Net.FarDistance"),
+	GBodycamNetFarDistance,
+	TEXT("Pawns farther than this (cm) from every player's view replicate at the minimum rate."));
+
+namespace BodycamNetRate
+{
+	static constexpr float Near = 30.f; // Hz
+	static constexpr float Far  = 4.f;
+	static constexpr float MinUpdateFrequency = 2.f;
+	static constexpr float Interval = 0.5f; // s between rate updates
+}
+
+namespace BodycamStreamingProbe
+{
+	static constexpr float Interval = 0.25f; // s between polls
+}
 
 // Sets default values
 ABodycamCharacter::ABodycamCharacter()
 {
- 	// Set this character to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
+	LLM_SCOPE_BYTAG(Bodycam_Character);
+
+ 	// No per-actor Tick: bodycam motion for every pawn is batched in UBodycamMotionSubsystem.
+	PrimaryActorTick.bCanEverTick = false;
+
 	GetCapsuleComponent()->InitCapsuleSize(42.f, 96.0f);
 
 	// We rotate with mouse, not with movement
@@ -31,8 +86,8 @@ ABodycamCharacter::ABodycamCharacter()
 	FPCamera->bUsePawnControlRotation = true; // Rotate the camera with the controller
 	FPCamera->SetFieldOfView(90.f);
 
-	// Start with your preferred base FOV
-	FPCamera->SetFieldOfView(BaseFOV);
+	// Start with your preferred base FOV (the profile is applied in BeginPlay)
+	FPCamera->SetFieldOfView(FBodycamTuning().BaseFOV);
 
 	// Flashlight attached to the CAMERA so it follows mouse exactly
 	Flashlight = CreateDefaultSubobject<USpotLightComponent>(TEXT("Flashlight"));
@@ -46,15 +101,145 @@ ABodycamCharacter::ABodycamCharacter()
 	Flashlight->bUseInverseSquaredFalloff = false; // more "gamey" falloff
 	Flashlight->SetVisibility(false);
 
+	// Focus + IA_Interact (ticks only while a local player controls us, see NotifyControllerChanged)
+	Interaction = CreateDefaultSubobject<UBodycamInteractionComponent>(TEXT("Interaction"));
+	InteractAction = TSoftObjectPtr<UInputAction>(FSoftObjectPath(TEXT("/Game/Input/IA_Interact.IA_Interact")));
+
 	// Default walk speed
-	GetCharacterMovement()->MaxWalkSpeed = WalkSpeed;
+	GetCharacterMovement()->MaxWalkSpeed = FBodycamTuning().WalkSpeed;
+
+	// replication rate is lowered by distance on the server (UpdateNetRate)
+	SetNetUpdateFrequency(BodycamNetRate::Near);
+	SetMinNetUpdateFrequency(BodycamNetRate::MinUpdateFrequency);
 }
 
 // Called when the game starts or when spawned
 void ABodycamCharacter::BeginPlay()
 {
+	LLM_SCOPE_BYTAG(Bodycam_Character);
+
 	Super::BeginPlay();
 
+	ApplyTuning();
+	RefreshLatencyTracker();
+
+	// the mapping context is added with the bindings (BindInput), once the input assets are in;
+	// bodycam motion is applied to the final view by the camera manager (also on possession, see
+	// NotifyControllerChanged)
+	UBodycamCameraModifier::AddTo(Cast<APlayerController>(Controller));
+
+	// same seed on every machine (derived from the name on the server, replicated to clients)
+	if (HasAuthority())
+	{
+		MotionSeed = (uint16)GetTypeHash(GetFName());
+		if (GetNetMode() != NM_Standalone)
+		{
+			GetWorldTimerManager().SetTimer(NetRateTimer, this, &ABodycamCharacter::UpdateNetRate, BodycamNetRate::Interval, true);
+		}
+	}
+
+	if (UBodycamMotionSubsystem* Motion = GetWorld()->GetSubsystem<UBodycamMotionSubsystem>())
+	{
+		Motion->RegisterPawn(this);
+	}
+	if (UBodycamFlashlightGovernor* Governor = GetWorld()->GetSubsystem<UBodycamFlashlightGovernor>())
+	{
+		Governor->RegisterLight(this, Flashlight);
+	}
+	if (UBodycamLitQuerySubsystem* LitQuery = GetWorld()->GetSubsystem<UBodycamLitQuerySubsystem>())
+	{
+		LitQuery->RegisterLight(Flashlight);
+	}
+
+	// every pawn registers; GetStreamingSources only answers while locally controlled
+	if (GetWorld()->IsPartitionedWorld())
+	{
+		if (UWorldPartitionSubsystem* WorldPartition = GetWorld()->GetSubsystem<UWorldPartitionSubsystem>())
+		{
+			StreamingSourceName = FName(*FString::Printf(TEXT("%s_Predicted"), *GetName()));
+			WorldPartition->RegisterStreamingSourceProvider(this);
+		}
+	}
+	UpdateStreamingProbe();
+}
+
+void ABodycamCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UBodycamMotionSubsystem* Motion = GetWorld()->GetSubsystem<UBodycamMotionSubsystem>())
+	{
+		Motion->UnregisterPawn(this);
+	}
+	if (UBodycamFlashlightGovernor* Governor = GetWorld()->GetSubsystem<UBodycamFlashlightGovernor>())
+	{
+		Governor->UnregisterLight(Flashlight);
+	}
+	if (UBodycamLitQuerySubsystem* LitQuery = GetWorld()->GetSubsystem<UBodycamLitQuerySubsystem>())
+	{
+		LitQuery->UnregisterLight(Flashlight);
+	}
+	if (UWorldPartitionSubsystem* WorldPartition = GetWorld()->GetSubsystem<UWorldPartitionSubsystem>())
+	{
+		WorldPartition->UnregisterStreamingSourceProvider(this);
+	}
+	GetWorldTimerManager().ClearTimer(StreamingProbeTimer);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+// Called to bind functionality to input
+void ABodycamCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
+{
+	Super::SetupPlayerInputComponent(PlayerInputComponent);
+
+	UEnhancedInputComponent* EIC = CastChecked<UEnhancedInputComponent>(PlayerInputComponent);
+
+	// normally the startup preload already has these; otherwise bind when they arrive instead of blocking
+	TArray<FSoftObjectPath> Missing;
+	GatherInputAssets(Missing);
+	Missing.RemoveAll([](const FSoftObjectPath& Path) { return Path.ResolveObject() != nullptr; });
+	if (Missing.Num() == 0)
+	{
+		BindInput(EIC);
+		return;
+	}
+
+	InputAssetsHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(Missing),
+		FStreamableDelegate::CreateWeakLambda(this, [this, WeakEIC = TWeakObjectPtr<UEnhancedInputComponent>(EIC)]()
+		{
+			// the pawn may have been unpossessed (and its input component replaced) meanwhile
+			if (WeakEIC.IsValid() && WeakEIC.Get() == InputComponent)
+			{
+				BindInput(WeakEIC.Get());
+			}
+		}),
+		FStreamableManager::AsyncLoadHighPriority);
+}
+
+void ABodycamCharacter::GatherInputAssets(TArray<FSoftObjectPath>& OutPaths) const
+{
+	const FSoftObjectPath Paths[] =
+	{
+		IMC_Player.ToSoftObjectPath(),
+		MoveAction.ToSoftObjectPath(),
+		LookAction.ToSoftObjectPath(),
+		JumpAction.ToSoftObjectPath(),
+		SprintAction.ToSoftObjectPath(),
+		FlashlightAction.ToSoftObjectPath(),
+		InteractAction.ToSoftObjectPath(),
+	};
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		if (Path.IsValid())
+		{
+			OutPaths.AddUnique(Path);
+		}
+	}
+}
+
+void ABodycamCharacter::BindInput(UEnhancedInputComponent* EIC)
+{
+	InputAssetsHandle.Reset();
+
 	// Add the mapping context
 	if (APlayerController* PC = Cast<APlayerController>(Controller))
 	{
@@ -62,293 +247,507 @@ void ABodycamCharacter::BeginPlay()
 		{
 			if (UEnhancedInputLocalPlayerSubsystem* Sub = LP->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>())
 			{
-				if (IMC_Player) Sub->AddMappingContext(IMC_Player, 0);
+				if (UInputMappingContext* IMC = IMC_Player.Get()) Sub->AddMappingContext(IMC, 0);
 			}
 		}
 	}
 
-	if (FPCameraPivot)
-    {
-        PivotBaseRelLoc = FPCameraPivot->GetRelativeLocation();
-		FRandomStream RS;
-    	RS.Initialize(GetUniqueID()); // deterministic per pawn
-    	BreathSeedX     = RS.FRandRange(-1000.f, 1000.f);
-    	BreathSeedY     = RS.FRandRange(-1000.f, 1000.f);
-    	BreathSeedZ     = RS.FRandRange(-1000.f, 1000.f);
-    	BreathSeedPitch = RS.FRandRange(-1000.f, 1000.f);
-    	BreathSeedRoll  = RS.FRandRange(-1000.f, 1000.f);
-    }
-
-
-	
-}
+	// Jump (fire once)
+	if (const UInputAction* Jump = JumpAction.Get())
+	{
+		EIC->BindAction(Jump, ETriggerEvent::Started,   this, &ACharacter::Jump);
+		EIC->BindAction(Jump, ETriggerEvent::Completed, this, &ACharacter::StopJumping);
+	}
 
-// Called every frame
-void ABodycamCharacter::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-	UpdateBodycamPOV(DeltaTime);
+	// Move / Look (yours)
+	if (const UInputAction* MoveIA = MoveAction.Get()) EIC->BindAction(MoveIA, ETriggerEvent::Triggered, this, &ABodycamCharacter::Move);
+	if (const UInputAction* LookIA = LookAction.Get()) EIC->BindAction(LookIA, ETriggerEvent::Triggered, this, &ABodycamCharacter::Look);
 
-	// --- FLASHLIGHT: movement sway & jump/land impulses ---
-	UCharacterMovementComponent* Move = GetCharacterMovement();
-	const bool bGrounded = Move ? Move->IsMovingOnGround() : true;
+	// Sprint
+	if (const UInputAction* Sprint = SprintAction.Get())
+	{
+		EIC->BindAction(Sprint, ETriggerEvent::Started,   this, &ABodycamCharacter::StartSprint);
+		EIC->BindAction(Sprint, ETriggerEvent::Completed, this, &ABodycamCharacter::StopSprint);
+	}
 
-	const FVector V = GetVelocity();
-	const float   Speed = V.Size2D();
-	const float   MaxSpd = Move ? FMath::Max(1.f, Move->MaxWalkSpeed) : 600.f;
-	const float   SpeedAlpha = FMath::Clamp(Speed / MaxSpd, 0.f, 1.f);
+	// Flashlight
+	if (const UInputAction* Flash = FlashlightAction.Get())
+	{
+		EIC->BindAction(Flash, ETriggerEvent::Started, this, &ABodycamCharacter::ToggleFlashlight);
+	}
 
-	// forward/strafe direction (−1..+1) from velocity
-	const FVector2D v2(V.X, V.Y);
-	const FVector2D f2(GetActorForwardVector().X, GetActorForwardVector().Y);
-	const FVector2D r2(GetActorRightVector().X,   GetActorRightVector().Y);
-	const FVector2D vN = v2.IsNearlyZero() ? FVector2D::ZeroVector : v2.GetSafeNormal();
-	const float fwdNorm    = FVector2D::DotProduct(vN, f2.GetSafeNormal()); // forward/back
-	const float strafeNorm = FVector2D::DotProduct(vN, r2.GetSafeNormal()); // left/right
+	// Interact (whatever the interaction component has in focus)
+	if (const UInputAction* Use = InteractAction.Get())
+	{
+		EIC->BindAction(Use, ETriggerEvent::Started, this, &ABodycamCharacter::Interact);
+	}
 
-	// sprint amplifies sway a bit
-	const float sprintScale = bIsSprinting ? FlashSprintSwayScale : 1.f;
+	if (UBodycamPreloadSubsystem* Preload = UGameInstance::GetSubsystem<UBodycamPreloadSubsystem>(GetGameInstance()))
+	{
+		Preload->NotifyControllable(this);
+	}
+}
 
-	// target sway from movement + a touch of bob tied to your BobTime
-	const float phase = BobTime * 2.f * PI;
-	const float targetMoveYaw   = (strafeNorm * FlashMoveYawByStrafe   * SpeedAlpha * sprintScale)
-								+ (FMath::Sin(phase * 0.5f) * FlashBobYaw   * SpeedAlpha);
-	const float targetMovePitch = (-fwdNorm   * FlashMovePitchBySpeed  * SpeedAlpha * sprintScale) // dip when moving fast
-								+ (FMath::Sin(phase)        * FlashBobPitch * SpeedAlpha);
+void ABodycamCharacter::Move(const FInputActionValue& Val)
+{
+	LLM_SCOPE_BYTAG(Bodycam_Character);
+	BODYCAM_SCOPE(STAT_BodycamMove, BodycamMove);
+	INC_DWORD_STAT(STAT_BodycamInputEvents);
+	BODYCAM_NO_ALLOC_SCOPE(Move);
 
-	// smooth the sway so it doesn’t jitter
-	FlashMoveYaw   = FMath::FInterpTo(FlashMoveYaw,   targetMoveYaw,   DeltaTime, FlashMoveInterp);
-	FlashMovePitch = FMath::FInterpTo(FlashMovePitch, targetMovePitch, DeltaTime, FlashMoveInterp);
+	const FVector2D Ax = Val.Get<FVector2D>();
+	AddMovementInput(GetActorForwardVector(), Ax.Y);
+	AddMovementInput(GetActorRightVector(),   Ax.X);
+}
 
-	// jump/land impulses
-	if (bFlashPrevGrounded && !bGrounded)  FlashKickAccumPitch += FlashJumpPitchKick; // takeoff
-	if (!bFlashPrevGrounded && bGrounded)  FlashKickAccumPitch += FlashLandPitchKick; // landing thud
-	bFlashPrevGrounded = bGrounded;
-	FlashKickAccumPitch = FMath::FInterpTo(FlashKickAccumPitch, 0.f, DeltaTime, FlashKickReturnSpeed);
 
+void ABodycamCharacter::Look(const FInputActionValue& Val)
+{
+	LLM_SCOPE_BYTAG(Bodycam_Character);
+	BODYCAM_SCOPE(STAT_BodycamLook, BodycamLook);
+	INC_DWORD_STAT(STAT_BodycamInputEvents);
+	BODYCAM_NO_ALLOC_SCOPE(Look);
 
-	// Free-aim: recentre the offsets when no input, then apply to flashlight
-	FlashAimYaw   = FMath::FInterpTo(FlashAimYaw,   0.f, DeltaTime, FlashAimReturnSpeed);
-	FlashAimPitch = FMath::FInterpTo(FlashAimPitch, 0.f, DeltaTime, FlashAimReturnSpeed);
+	// raw input units from Enhanced Input; high polling rate mice fire this many times a frame
+	AddLookInput(FVector2f(Val.Get<FVector2D>()));
+}
 
-	if (Flashlight)
+void ABodycamCharacter::AddLookInput(const FVector2f& Delta, double EventSeconds)
+{
+	const double Now = EventSeconds > 0.0 ? EventSeconds : FPlatformTime::Seconds();
+	if (Hot.PendingLookEvents++ == 0)
 	{
-		// your free-aim target (keep your invert toggles)
-		const float PitchFA = bInvertFlashAimPitch ? -FlashAimPitch : FlashAimPitch;
-		const float YawFA   = bInvertFlashAimYaw   ? -FlashAimYaw   : FlashAimYaw;
-
-		// ADD movement & kicks to free-aim
-		const float PitchToApply = PitchFA + FlashMovePitch + FlashKickAccumPitch;
-		const float YawToApply   = YawFA   + FlashMoveYaw;
-		const FRotator Target(-PitchToApply, YawToApply, 0.f);
-		FRotator Cur = Flashlight->GetRelativeRotation();
-		Cur.Pitch = FMath::FInterpTo(Cur.Pitch, Target.Pitch, DeltaTime, FlashAimSmoothing);
-		Cur.Yaw   = FMath::FInterpTo(Cur.Yaw,   Target.Yaw,   DeltaTime, FlashAimSmoothing);
-		Cur.Roll  = 0.f;
-		Flashlight->SetRelativeRotation(Cur);
+		Hot.PendingLookFirstTime = Now;
 	}
+	Hot.PendingLookLastTime = Now;
+	Hot.PendingLook += Delta;
 
-	// Speed-based FOV (sensor feel)
-	if (FPCamera)
+	// nothing resolves the buffer for a pawn the motion subsystem doesn't run (editor worlds, no camera pivot)
+	if (Hot.MotionIndex == INDEX_NONE)
 	{
-		const float SpeedForFOV = GetVelocity().Size2D();
-		const float alpha = FMath::Clamp((SpeedForFOV - WalkSpeed) / FMath::Max(1.f, (SprintSpeed - WalkSpeed)), 0.f, 1.f);
-		const float TargetFOV = FMath::Lerp(BaseFOV, SprintFOV, alpha);
-		const float NewFOV = FMath::FInterpTo(FPCamera->FieldOfView, TargetFOV, DeltaTime, FOVInterpSpeed);
-		FPCamera->SetFieldOfView(NewFOV);
+		ResolvePendingLook(GetTuning());
+		LatchViewRotation(GetWorld() ? GetWorld()->GetDeltaSeconds() : 0.f);
 	}
 }
 
-void ABodycamCharacter::UpdateBodycamPOV(float DeltaSeconds)
+void ABodycamCharacter::ResolvePendingLook(const FBodycamTuning& T)
 {
-	if (!FPCameraPivot) return;
+	BODYCAM_NO_ALLOC_SCOPE(ResolveLook);
+
+	Hot.ResolvedLook = Hot.PendingLook;
+	if (Hot.PendingLookEvents == 0)
+	{
+		return;
+	}
+	if (LatencyTracker)
+	{
+		LatencyTracker->BeginSample(Hot.PendingLookFirstTime, FPlatformTime::Seconds());
+	}
+	const FVector2f Ax = Hot.PendingLook;
+	Hot.PendingLook = FVector2f::ZeroVector;
+	Hot.PendingLookEvents = 0;
+
+    // Split into a "leaked" part (always goes to camera) and the "buffered" part (goes to free-aim first)
+    const float LeakYawInput   = Ax.X * T.FreeAimLeak;
+    const float LeakPitchInput = Ax.Y * T.FreeAimLeak; // positive = mouse up
 
-	UCharacterMovementComponent* Move = GetCharacterMovement();
-	const bool bGrounded = Move ? Move->IsMovingOnGround() : true;
+    const float ProcYawInput   = Ax.X * (1.f - T.FreeAimLeak);
+    const float ProcPitchInput = Ax.Y * (1.f - T.FreeAimLeak);
 
-	const FVector Vel = GetVelocity();
-	const float  Speed2D = FVector(Vel.X, Vel.Y, 0.f).Size();
+    // --- Convert processed input to degrees for the free-aim buffer ---
+    const float yawDegIn   = ProcYawInput   * T.LookToDegYaw;
+    const float pitchDegIn = ProcPitchInput * T.LookToDegPitch;
+
+    // YAW: clamp into [-max, +max]
+    const float prevAimYaw = Hot.FlashAimYaw;
+    Hot.FlashAimYaw = FMath::Clamp(Hot.FlashAimYaw + yawDegIn, -T.FlashAimMaxYaw, T.FlashAimMaxYaw);
+    const float usedYawDeg = Hot.FlashAimYaw - prevAimYaw;
 
-	// --- Breathing (noise-based, non-circular) ---
-	BreathTime += DeltaSeconds;                  // keep our own time; scale below
-	const float t = BreathTime * BreathNoiseSpeed;
+    // PITCH: clamp into [-max, +max]
+    const float prevAimPitch = Hot.FlashAimPitch;
+    Hot.FlashAimPitch = FMath::Clamp(Hot.FlashAimPitch + pitchDegIn, -T.FlashAimMaxPitch, T.FlashAimMaxPitch);
+    const float usedPitchDeg = Hot.FlashAimPitch - prevAimPitch;
 
-	// Perlin noise in [-1,1] per channel
-	const float nx = FMath::PerlinNoise1D(t * 0.87f + BreathSeedX);
-	const float ny = FMath::PerlinNoise1D(t * 1.03f + BreathSeedY);
-	const float nz = FMath::PerlinNoise1D(t * 1.19f + BreathSeedZ);
-	const float np = FMath::PerlinNoise1D(t * 0.77f + BreathSeedPitch);
-	const float nr = FMath::PerlinNoise1D(t * 0.93f + BreathSeedRoll);
+    // Convert "used for flashlight" back to input units so we know what's left for the camera
+    const float yawUnitsUsed   = (T.LookToDegYaw   > KINDA_SMALL_NUMBER) ? (usedYawDeg   / T.LookToDegYaw)   : 0.f;
+    const float pitchUnitsUsed = (T.LookToDegPitch > KINDA_SMALL_NUMBER) ? (usedPitchDeg / T.LookToDegPitch) : 0.f;
 
-	// reduce breathing while moving so it doesn't fight the bob
-	float MoveAlpha = 0.f;
-	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+    // Leftover input (from the processed part) goes to the camera
+    const float leftoverYawInput   = ProcYawInput   - yawUnitsUsed;
+    const float leftoverPitchInput = ProcPitchInput - pitchUnitsUsed;
+
+    // Total input to camera = leak + leftover, scaled by CAMERA sensitivity (independent of flashlight)
+    Hot.PendingViewTurn.X += (LeakYawInput   + leftoverYawInput)   * T.CameraYawDegPerInput;
+    Hot.PendingViewTurn.Y += (LeakPitchInput + leftoverPitchInput) * T.CameraPitchDegPerInput;
+}
+
+void ABodycamCharacter::RefreshLatencyTracker()
+{
+	LLM_SCOPE_BYTAG(Bodycam_Character);
+
+	// the tracker only lives while tracking is on, and only on the pawn a local player looks with
+	const bool bTrackLatency = FBodycamLatencyTracker::IsEnabled() && IsLocallyControlled();
+	if (bTrackLatency != LatencyTracker.IsValid())
 	{
-	    const float MaxSpd = FMath::Max(1.f, MoveComp->MaxWalkSpeed);
-	    MoveAlpha = FMath::Clamp(GetVelocity().Size2D() / MaxSpd, 0.f, 1.f);
+		if (bTrackLatency) LatencyTracker = MakeUnique<FBodycamLatencyTracker>();
+		else               LatencyTracker.Reset();
 	}
-	const float BreathMoveScale = 1.f - 0.6f * MoveAlpha; // keep ~40% at full sprint
+}
 
-	// final breathing offsets
-	const float BreathX       = nx * BreathXYIntensity * BreathMoveScale;
-	const float BreathY       = ny * BreathXYIntensity * BreathMoveScale;
-	const float BreathZ       = nz * BreathIntensity    * BreathMoveScale;
-	const float BreathPitch   = np * BreathPitchDeg     * BreathMoveScale;
-	const float BreathRoll    = nr * BreathRollDeg      * BreathMoveScale;
+FRotator ABodycamCharacter::LatchViewRotation(float DeltaSeconds)
+{
+	LLM_SCOPE_BYTAG(Bodycam_Character);
+	BODYCAM_NO_ALLOC_SCOPE(LatchView);
 
-	// ---------- Bob amplitude shaping ----------
-	float Scale = 0.f;
-	if (bGrounded && Speed2D > 10.f)
+	const FVector2f Turn = Hot.PendingViewTurn;
+	Hot.PendingViewTurn = FVector2f::ZeroVector;
+
+	// same rules as AddControllerYaw/PitchInput: local player controllers only
+	APlayerController* PC = Cast<APlayerController>(Controller);
+	if (Turn.IsZero() || !PC || !PC->IsLocalController() || PC->IsLookInputIgnored())
 	{
-		const float SpeedNorm = Move ? FMath::Clamp(Speed2D / FMath::Max(1.f, Move->MaxWalkSpeed), 0.f, 2.f) : 0.f;
-		Scale = FMath::Lerp(1.0f, SprintBobScale, FMath::Clamp(SpeedNorm - 0.5f, 0.f, 1.f));
-		if (Move && Move->IsCrouching()) Scale *= CrouchBobScale;
+		return FRotator::ZeroRotator;
+	}
 
-		BobTime += DeltaSeconds * BobFrequency;
+	// keep the scaling the controller input path applied (mouse up looks up)
+	const bool bLegacyScales = GetDefault<UInputSettings>()->bEnableLegacyInputScales;
+	FRotator DeltaRot(
+		-Turn.Y * (bLegacyScales ? PC->GetDeprecatedInputPitchScale() : 1.f),
+		 Turn.X * (bLegacyScales ? PC->GetDeprecatedInputYawScale()   : 1.f),
+		0.f);
+
+	// what APlayerController::UpdateRotation does, just later in the frame
+	const FRotator OldRot = PC->GetControlRotation();
+	FRotator ViewRot = OldRot;
+	if (PC->PlayerCameraManager)
+	{
+		PC->PlayerCameraManager->ProcessViewRotation(DeltaSeconds, ViewRot, DeltaRot);
 	}
 	else
 	{
-		BobTime = 0.f;
+		ViewRot += DeltaRot;
 	}
+	PC->SetControlRotation(ViewRot);
+	FaceRotation(ViewRot, DeltaSeconds);
+	if (LatencyTracker)
+	{
+		LatencyTracker->Stamp(EBodycamLatencyStage::Controller, FPlatformTime::Seconds());
+	}
+
+	return (ViewRot - OldRot).GetNormalized();
+}
 
-	// ---------- Landing kick ----------
-	if (bWasGrounded && !bGrounded) JumpOffset = JumpKickUp;          // takeoff bump up
-	if (!bWasGrounded && bGrounded) LandingOffset = LandingKick;      // landing dip
 
-	bWasGrounded  = bGrounded;
 
-	// decay both
-	LandingOffset = FMath::FInterpTo(LandingOffset, 0.f, DeltaSeconds, LandingDamp);
-	JumpOffset    = FMath::FInterpTo(JumpOffset,    0.f, DeltaSeconds, JumpDamp);
+/*Sprinting and Flashlight Implementations*/
+
+void ABodycamCharacter::StartSprint(const FInputActionValue& /*Value*/)
+{
+	INC_DWORD_STAT(STAT_BodycamInputEvents);
+	SetSprinting(true);
+}
 
-	// ---------- Bob offsets (X/Y/Z) ----------
-	const float Phase = BobTime * 2.f * PI;
-	const float OffZ  = (bGrounded ? FMath::Sin(Phase)        * (BobIntensity * Scale)         : 0.f);
-	const float OffY  = (bGrounded ? FMath::Sin(Phase * 0.5f) * (BobHorizontal * Scale)        : 0.f);
-	const float OffX  = (bGrounded ? -FMath::Cos(Phase)       * (BobForward   * Scale)         : 0.f);
+void ABodycamCharacter::StopSprint(const FInputActionValue& /*Value*/)
+{
+	INC_DWORD_STAT(STAT_BodycamInputEvents);
+	SetSprinting(false);
+}
 
+void ABodycamCharacter::SetSprinting(bool bSprint)
+{
+	const bool bChanged = Hot.bIsSprinting != bSprint;
+	Hot.bIsSprinting = bSprint;
+	ApplySprintSpeed();
 
-	// ---------- Apply ONE location update (X/Y/Z together) ----------
-	const FVector TargetRel = PivotBaseRelLoc + FVector(OffX + BreathX, OffY + BreathY, BreathZ + OffZ - LandingOffset + JumpOffset);
-	FVector CurRel = FPCameraPivot->GetRelativeLocation();
-	CurRel = FMath::VInterpTo(CurRel, TargetRel, DeltaSeconds, 10.f);
-	FPCameraPivot->SetRelativeLocation(CurRel);
+	// proxies need it for breath and sway
+	if (HasAuthority())
+	{
+		NetState.bSprinting = bSprint;
+	}
+	else if (bChanged && IsLocallyControlled() && GetNetMode() != NM_Standalone)
+	{
+		ServerSetSprinting(bSprint);
+	}
+}
 
-	// ---------- Rotation: strafe roll + bob nod + breathing ----------
-	const float Lateral     = FVector::DotProduct(Vel.GetSafeNormal2D(), GetActorRightVector()); // -1..1
-	const float TargetRoll  = (Lateral * StrafeRollDeg) + BreathRoll;                            // add noise roll
-	const float TargetPitch = FMath::Sin(Phase + PI * 0.5f) * (BobPitchDeg * Scale) + BreathPitch;
+void ABodycamCharacter::ApplySprintSpeed()
+{
+	const bool bSprint = Hot.bIsSprinting;
 
-	FRotator R = FPCameraPivot->GetRelativeRotation();
-	R.Roll  = FMath::FInterpTo(R.Roll,  TargetRoll,  DeltaSeconds, RollInterpSpeed);
-	R.Pitch = FMath::FInterpTo(R.Pitch, TargetPitch, DeltaSeconds, 6.f);
-	R.Yaw   = 0.f;
-	FPCameraPivot->SetRelativeRotation(R);
+	// registered pawns read the subsystem's shared copy, no need to resolve the overrides again
+	const UBodycamMotionSubsystem* Motion = GetWorld() ? GetWorld()->GetSubsystem<UBodycamMotionSubsystem>() : nullptr;
+	if (const FBodycamTuning* T = Motion ? Motion->FindTuning(this) : nullptr)
+	{
+		GetCharacterMovement()->MaxWalkSpeed = bSprint ? T->SprintSpeed : T->WalkSpeed;
+	}
+	else
+	{
+		const FBodycamTuning Resolved = GetTuning();
+		GetCharacterMovement()->MaxWalkSpeed = bSprint ? Resolved.SprintSpeed : Resolved.WalkSpeed;
+	}
 }
 
-// Called to bind functionality to input
-void ABodycamCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
+FBodycamTuning ABodycamCharacter::GetTuning() const
 {
-	Super::SetupPlayerInputComponent(PlayerInputComponent);
+	return UBodycamProfile::Resolve(Profile, TuningOverrides);
+}
 
-	if (UEnhancedInputComponent* EIC = CastChecked<UEnhancedInputComponent>(PlayerInputComponent))
+void ABodycamCharacter::SetProfile(UBodycamProfile* NewProfile)
 {
-	// Jump (fire once)
-	if (JumpAction)
+	Profile = NewProfile;
+	if (HasActorBegunPlay())
 	{
-		EIC->BindAction(JumpAction, ETriggerEvent::Started,   this, &ACharacter::Jump);
-		EIC->BindAction(JumpAction, ETriggerEvent::Completed, this, &ACharacter::StopJumping);
+		ApplyTuning();
 	}
+}
 
-	// Move / Look (yours)
-	if (MoveAction) EIC->BindAction(MoveAction, ETriggerEvent::Triggered, this, &ABodycamCharacter::Move);
-	if (LookAction) EIC->BindAction(LookAction, ETriggerEvent::Triggered, this, &ABodycamCharacter::Look);
-
-	// Sprint
-	if (SprintAction)
+void ABodycamCharacter::SetTuningOverrides(TArray<FBodycamTuningOverride> NewOverrides)
+{
+	TuningOverrides = MoveTemp(NewOverrides);
+	if (HasActorBegunPlay())
 	{
-		EIC->BindAction(SprintAction, ETriggerEvent::Started,   this, &ABodycamCharacter::StartSprint);
-		EIC->BindAction(SprintAction, ETriggerEvent::Completed, this, &ABodycamCharacter::StopSprint);
+		ApplyTuning();
 	}
+}
 
-	// Flashlight
-	if (FlashlightAction)
+void ABodycamCharacter::ApplyTuning()
+{
+	const FBodycamTuning T = GetTuning();
+	GetCharacterMovement()->MaxWalkSpeed = Hot.bIsSprinting ? T.SprintSpeed : T.WalkSpeed;
+	if (FPCamera)
+	{
+		FPCamera->SetFieldOfView(T.BaseFOV);
+	}
+	if (UBodycamMotionSubsystem* Motion = GetWorld()->GetSubsystem<UBodycamMotionSubsystem>())
 	{
-		EIC->BindAction(FlashlightAction, ETriggerEvent::Started, this, &ABodycamCharacter::ToggleFlashlight);
+		Motion->RefreshTuning(this, T);
 	}
 }
 
+void ABodycamCharacter::ToggleFlashlight(const FInputActionValue& /*Value*/)
+{
+	INC_DWORD_STAT(STAT_BodycamInputEvents);
+	if (!Flashlight) return;
+
+	Flashlight->ToggleVisibility(true);
+	if (HasAuthority())
+	{
+		NetState.bFlashlightOn = Flashlight->IsVisible();
+	}
+	else
+	{
+		ServerSetFlashlight(Flashlight->IsVisible());
+	}
 }
 
-void ABodycamCharacter::Move(const FInputActionValue& Val)
+void ABodycamCharacter::Interact(const FInputActionValue& /*Value*/)
 {
-	const FVector2D Ax = Val.Get<FVector2D>();
-	AddMovementInput(GetActorForwardVector(), Ax.Y);
-	AddMovementInput(GetActorRightVector(),   Ax.X);
+	INC_DWORD_STAT(STAT_BodycamInputEvents);
+	if (Interaction)
+	{
+		Interaction->Interact();
+	}
 }
 
 
-void ABodycamCharacter::Look(const FInputActionValue& Val)
+
+/*Replication*/
+
+void ABodycamCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
-	const FVector2D Ax = Val.Get<FVector2D>(); // raw input units from Enhanced Input
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    // Split into a "leaked" part (always goes to camera) and the "buffered" part (goes to free-aim first)
-    const float LeakYawInput   = Ax.X * FreeAimLeak;
-    const float LeakPitchInput = Ax.Y * FreeAimLeak; // positive = mouse up
+	// the owner already has its own flashlight state
+	DOREPLIFETIME_CONDITION(ABodycamCharacter, NetState, COND_SkipOwner);
+	DOREPLIFETIME_CONDITION(ABodycamCharacter, MotionSeed, COND_InitialOnly);
+}
 
-    const float ProcYawInput   = Ax.X * (1.f - FreeAimLeak);
-    const float ProcPitchInput = Ax.Y * (1.f - FreeAimLeak);
+void ABodycamCharacter::SendNetState()
+{
+	if (GetNetMode() == NM_Standalone)
+	{
+		return;
+	}
 
-    // --- Convert processed input to degrees for the free-aim buffer ---
-    const float yawDegIn   = ProcYawInput   * LookToDegYaw;
-    const float pitchDegIn = ProcPitchInput * LookToDegPitch;
+	FBodycamNetState Next = NetState;
+	Next.SetAim(Hot.FlashAimYaw, Hot.FlashAimPitch);
+	if (Next.AimYaw == LastSentNetState.AimYaw && Next.AimPitch == LastSentNetState.AimPitch)
+	{
+		return;
+	}
 
-    // YAW: clamp into [-max, +max]
-    const float prevAimYaw = FlashAimYaw;
-    FlashAimYaw = FMath::Clamp(FlashAimYaw + yawDegIn, -FlashAimMaxYaw, FlashAimMaxYaw);
-    const float usedYawDeg = FlashAimYaw - prevAimYaw;
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (Now - LastNetSendTime < 1.0 / FMath::Max(1.f, GBodycamNetAimRate))
+	{
+		return;
+	}
+	LastNetSendTime = Now;
+	LastSentNetState = Next;
 
-    // PITCH: clamp into [-max, +max]
-    const float prevAimPitch = FlashAimPitch;
-    FlashAimPitch = FMath::Clamp(FlashAimPitch + pitchDegIn, -FlashAimMaxPitch, FlashAimMaxPitch);
-    const float usedPitchDeg = FlashAimPitch - prevAimPitch;
+	if (HasAuthority())
+	{
+		NetState.AimYaw   = Next.AimYaw;
+		NetState.AimPitch = Next.AimPitch;
+	}
+	else
+	{
+		ServerSetFlashlightAim(Next);
+	}
+}
 
-    // Convert "used for flashlight" back to input units so we know what's left for the camera
-    const float yawUnitsUsed   = (LookToDegYaw   > KINDA_SMALL_NUMBER) ? (usedYawDeg   / LookToDegYaw)   : 0.f;
-    const float pitchUnitsUsed = (LookToDegPitch > KINDA_SMALL_NUMBER) ? (usedPitchDeg / LookToDegPitch) : 0.f;
+void ABodycamCharacter::ServerSetFlashlight_Implementation(bool bOn)
+{
+	NetState.bFlashlightOn = bOn;
+	if (Flashlight) Flashlight->SetVisibility(bOn);
+}
 
-    // Leftover input (from the processed part) goes to the camera
-    const float leftoverYawInput   = ProcYawInput   - yawUnitsUsed;
-    const float leftoverPitchInput = ProcPitchInput - pitchUnitsUsed;
+void ABodycamCharacter::ServerSetSprinting_Implementation(bool bSprint)
+{
+	SetSprinting(bSprint);
+}
 
-    // Total input to camera = leak + leftover, scaled by CAMERA sensitivity (independent of flashlight)
-    const float camYawDeltaDeg   = (LeakYawInput   + leftoverYawInput)   * CameraYawDegPerInput;
-    const float camPitchDeltaDeg = (LeakPitchInput + leftoverPitchInput) * CameraPitchDegPerInput;
+void ABodycamCharacter::ServerSetFlashlightAim_Implementation(FBodycamNetState State)
+{
+	NetState.AimYaw   = State.AimYaw;
+	NetState.AimPitch = State.AimPitch;
+
+	// the server's own view of this pawn
+	Hot.FlashAimYaw   = NetState.GetAimYaw();
+	Hot.FlashAimPitch = NetState.GetAimPitch();
+}
 
-    // Apply to camera. If you prefer Unreal's "mouse up looks up", keep pitch negative here:
-    AddControllerYawInput(camYawDeltaDeg);
-    AddControllerPitchInput(-camPitchDeltaDeg); // invert for typical FPS feel
+void ABodycamCharacter::OnRep_NetState()
+{
+	if (Flashlight) Flashlight->SetVisibility(NetState.bFlashlightOn);
 
+	// Gather picks sprint up for the breath level and flashlight sway
+	if (Hot.bIsSprinting != NetState.bSprinting)
+	{
+		Hot.bIsSprinting = NetState.bSprinting;
+		ApplySprintSpeed();
+	}
 
+	// the motion subsystem smooths and recenters this like it does for the owner
+	Hot.FlashAimYaw   = NetState.GetAimYaw();
+	Hot.FlashAimPitch = NetState.GetAimPitch();
 }
 
+void ABodycamCharacter::OnRep_MotionSeed()
+{
+	if (UBodycamMotionSubsystem* Motion = GetWorld()->GetSubsystem<UBodycamMotionSubsystem>())
+	{
+		Motion->SetMotionSeed(this, MotionSeed);
+	}
+}
 
+void ABodycamCharacter::UpdateNetRate()
+{
+	// distance to the closest player view other than our own
+	float ClosestSq = MAX_flt;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (!PC || PC->GetPawn() == this)
+		{
+			continue;
+		}
+		FVector ViewLoc;
+		FRotator ViewRot;
+		PC->GetPlayerViewPoint(ViewLoc, ViewRot);
+		ClosestSq = FMath::Min(ClosestSq, (float)FVector::DistSquared(ViewLoc, GetActorLocation()));
+	}
 
-/*Sprinting and Flashlight Implementations*/
+	const float Alpha = FMath::GetMappedRangeValueClamped(
+		FVector2f(GBodycamNetNearDistance, GBodycamNetFarDistance), FVector2f(1.f, 0.f), FMath::Sqrt(ClosestSq));
+	SetNetUpdateFrequency(FMath::Lerp(BodycamNetRate::Far, BodycamNetRate::Near, Alpha));
+}
 
-void ABodycamCharacter::StartSprint(const FInputActionValue& /*Value*/)
+void ABodycamCharacter::NotifyControllerChanged()
 {
-	bIsSprinting = true;
-	GetCharacterMovement()->MaxWalkSpeed = SprintSpeed;
+	Super::NotifyControllerChanged();
+
+	// the camera modifier follows possession: off the player that left, onto a local one that took over
+	if (PreviousController != Controller)
+	{
+		UBodycamCameraModifier::RemoveFrom(Cast<APlayerController>(PreviousController));
+	}
+	UBodycamCameraModifier::AddTo(Cast<APlayerController>(Controller));
+
+	RefreshLatencyTracker();
+	UpdateStreamingProbe();
+	if (Interaction)
+	{
+		Interaction->RefreshTickEnabled();
+	}
 }
 
-void ABodycamCharacter::StopSprint(const FInputActionValue& /*Value*/)
+int32 ABodycamCharacter::PredictStreaming(const FBodycamStreamingPrediction& Settings, FVector (&OutOffsets)[FBodycamStreamingPrediction::MaxShapes]) const
 {
-	bIsSprinting = false;
-	GetCharacterMovement()->MaxWalkSpeed = WalkSpeed;
+	const UBodycamMotionSubsystem* Motion = GetWorld()->GetSubsystem<UBodycamMotionSubsystem>();
+	const FBodycamTuning* T = Motion ? Motion->FindTuning(this) : nullptr;
+	const float SprintSpeed = T ? T->SprintSpeed : GetCharacterMovement()->MaxWalkSpeed;
+	return Settings.Predict(GetVelocity(), GetControlRotation().Vector(), IsSprinting(), SprintSpeed, OutOffsets);
 }
 
-void ABodycamCharacter::ToggleFlashlight(const FInputActionValue& /*Value*/)
+bool ABodycamCharacter::GetStreamingSources(TArray<FWorldPartitionStreamingSource>& OutStreamingSources) const
 {
-	if (Flashlight) Flashlight->ToggleVisibility(true);
+	const FBodycamStreamingPrediction Settings = FBodycamStreamingPrediction::FromConsole();
+	// local players only: AI officers are locally controlled on the server and in standalone too
+	if (!Settings.bEnabled || !IsPlayerControlled() || !IsLocallyControlled())
+	{
+		return false;
+	}
+
+	FVector Offsets[FBodycamStreamingPrediction::MaxShapes];
+	const int32 NumShapes = PredictStreaming(Settings, Offsets);
+	if (NumShapes == 0)
+	{
+		return false;
+	}
+
+	// load only (no activation) and below the controller's own source, so it never competes
+	// with what is needed right now; zero rotation keeps the shape offsets in world space
+	FWorldPartitionStreamingSource& Source = OutStreamingSources.AddDefaulted_GetRef();
+	Source.Name = StreamingSourceName;
+	Source.Location = GetActorLocation();
+	Source.Rotation = FRotator::ZeroRotator;
+	Source.TargetState = EStreamingSourceTargetState::Loaded;
+	Source.bBlockOnSlowLoading = false;
+	Source.Priority = EStreamingSourcePriority::Low;
+	for (int32 s = 0; s < NumShapes; ++s)
+	{
+		FStreamingSourceShape& Shape = Source.Shapes.AddDefaulted_GetRef();
+		Shape.bUseGridLoadingRange = true;
+		Shape.LoadingRangeScale = Settings.LoadingRangeScale;
+		Shape.Location = Offsets[s];
+	}
+	return true;
+}
+
+void ABodycamCharacter::UpdateStreamingProbe()
+{
+	const bool bWanted = HasActorBegunPlay() && GetWorld()->IsPartitionedWorld() && IsPlayerControlled() && IsLocallyControlled();
+	if (bWanted && !StreamingProbeTimer.IsValid())
+	{
+		GetWorldTimerManager().SetTimer(StreamingProbeTimer, this, &ABodycamCharacter::PollStreamingProbe, BodycamStreamingProbe::Interval, true);
+	}
+	else if (!bWanted && StreamingProbeTimer.IsValid())
+	{
+		GetWorldTimerManager().ClearTimer(StreamingProbeTimer);
+	}
+}
+
+void ABodycamCharacter::PollStreamingProbe()
+{
+	const UWorldPartitionSubsystem* WorldPartition = GetWorld()->GetSubsystem<UWorldPartitionSubsystem>();
+	if (!WorldPartition)
+	{
+		return;
+	}
+
+	// timed whether or not prediction is on, so the two can be compared
+	FVector Offsets[FBodycamStreamingPrediction::MaxShapes];
+	const int32 NumShapes = PredictStreaming(FBodycamStreamingPrediction::FromConsole(), Offsets);
+	const FVector Farthest = GetActorLocation() + (NumShapes > 0 ? Offsets[NumShapes - 1] : FVector::ZeroVector);
+	StreamingProbe.Poll(*WorldPartition, NumShapes > 0 ? &Farthest : nullptr, FPlatformTime::Seconds());
 }
@@ -4,12 +4,35 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "BodycamLatency.h"
+#include "BodycamNetState.h"
+#include "BodycamProfile.h"
+#include "BodycamStreaming.h"
+#include "WorldPartition/WorldPartitionStreamingSource.h"
 #include "BodycamCharacter.generated.h"
 
 struct FInputActionValue;
 
+/**
+ * What the character itself touches every frame, packed together (64 bytes). Bob, breathing,
+ * landing and sway state is not here: it lives in UBodycamMotionSubsystem's arrays.
+ */
+struct FBodycamPawnHotState
+{
+	FVector2f PendingLook     = FVector2f::ZeroVector; // look input since the last resolve (raw units, summed)
+	FVector2f PendingViewTurn = FVector2f::ZeroVector; // resolved, not latched yet (deg, X = yaw, Y = pitch, mouse up +)
+	FVector2f ResolvedLook    = FVector2f::ZeroVector; // raw input the last resolve consumed (recording)
+	float FlashAimYaw   = 0.f;                         // current offset relative to camera (deg)
+	float FlashAimPitch = 0.f;
+	int32 PendingLookEvents = 0;
+	int32 MotionIndex = INDEX_NONE;                    // slot in UBodycamMotionSubsystem
+	double PendingLookFirstTime = 0.0;                 // FPlatformTime::Seconds() of the oldest buffered event
+	double PendingLookLastTime  = 0.0;
+	bool bIsSprinting = false;
+};
+
 UCLASS()
-class BODYCAMHORRORGAME_API ABodycamCharacter : public ACharacter
+class BODYCAMHORRORGAME_API ABodycamCharacter : public ACharacter, public IWorldPartitionStreamingSourceProvider
 {
 	GENERATED_BODY()
 
@@ -20,110 +43,128 @@ public:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	// Called when the pawn leaves play (unregisters from the bodycam motion subsystem)
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
-protected:
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
-	//Components
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
-	class USceneComponent* FPCameraPivot;
+	virtual void NotifyControllerChanged() override;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
-	class UCameraComponent* FPCamera;
+	// IWorldPartitionStreamingSourceProvider: look-ahead shapes while locally controlled (the
+	// player controller stays the source for where the pawn is now)
+	virtual bool GetStreamingSources(TArray<FWorldPartitionStreamingSource>& OutStreamingSources) const override;
+	virtual const UObject* GetStreamingSourceOwner() const override { return this; }
 
+	const FBodycamStreamingProbe& GetStreamingProbe() const { return StreamingProbe; }
 
-	//Enchanced Input
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Input")
-	class UInputMappingContext* IMC_Player;
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Input")
-	class UInputAction* MoveAction;
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Input")
-	class UInputAction* LookAction;
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Input")
-	class UInputAction* JumpAction;
+	class USpotLightComponent* GetFlashlight() const { return Flashlight; }
+	class USceneComponent* GetCameraPivot() const { return FPCameraPivot; }
 
-	//Input handlers
-	void Move(const FInputActionValue& Value);
-	void Look(const FInputActionValue& Value);
+	// Sprint state (input handlers and headless drivers go through here)
+	void SetSprinting(bool bSprint);
+	bool IsSprinting() const { return Hot.bIsSprinting; }
 
-public:	
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
+	// Bodycam profile (swapping it swaps the whole feel)
+	UFUNCTION(BlueprintCallable, Category="Bodycam")
+	void SetProfile(UBodycamProfile* NewProfile);
+	UBodycamProfile* GetProfile() const { return Profile; }
 
-private:
-	UPROPERTY(EditAnywhere, Category="Bodycam|Headbob")
-	float BobIntensity = 0.7f;              // cm up/down when moving
+	/** Profile values with this pawn's overrides applied. */
+	FBodycamTuning GetTuning() const;
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Headbob")
-	float BobFrequency = 4.5f;              // how fast the bob oscillates
+	/** Replaces this pawn's overrides (tuning sweeps, headless drivers). */
+	void SetTuningOverrides(TArray<FBodycamTuningOverride> NewOverrides);
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Headbob")
-	float CrouchBobScale = 0.65f;           // bob reduced while crouched
+	// Look input is only buffered here; UBodycamMotionSubsystem resolves it once per frame.
+	// Pawns the subsystem doesn't run apply it straight away.
+	// EventSeconds is when the event happened (FPlatformTime::Seconds(), 0 = now).
+	void AddLookInput(const FVector2f& Delta, double EventSeconds = 0.0);
+	FVector2f GetPendingLookInput() const { return Hot.PendingLook; }
+	FVector2f GetResolvedLookInput() const { return Hot.ResolvedLook; }
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Headbob")
-	float SprintBobScale = 1.4f;            // bob amplified at high speed
+	/** Turns the controller by the look resolved this frame; returns the rotation actually applied. */
+	FRotator LatchViewRotation(float DeltaSeconds);
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Headbob")
-	float BobHorizontal = 0.25f; // Y cm (side sway)
+	/** Look latency of this pawn while bodycam.Latency.Track is on (locally controlled only), else null. */
+	FBodycamLatencyTracker* GetLatencyTracker() const { return LatencyTracker.Get(); }
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Headbob") 
-	float BobForward   = 0.35f; // X cm (forward surge)
+	// Replicated breathing seed, the same on every machine
+	uint16 GetMotionSeed() const { return MotionSeed; }
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Headbob") 
-	float BobPitchDeg  = 0.4f;  // camera nod in degrees
+	/** Locally controlled pawns push their free-aim to the server (rate limited, only on change). */
+	void SendNetState();
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Breathing")
-	float BreathIntensity = 0.25f;          // cm idle breathing
+	/** Soft input assets (mapping context and actions) this pawn binds; what the startup preload streams. */
+	void GatherInputAssets(TArray<FSoftObjectPath>& OutPaths) const;
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Breathing")
-	float BreathXYIntensity = 0.25f;          // cm idle breathing
+	// Bound actions (headless drivers inject input through these)
+	const TSoftObjectPtr<class UInputAction>& GetMoveAction() const       { return MoveAction; }
+	const TSoftObjectPtr<class UInputAction>& GetLookAction() const       { return LookAction; }
+	const TSoftObjectPtr<class UInputAction>& GetJumpAction() const       { return JumpAction; }
+	const TSoftObjectPtr<class UInputAction>& GetSprintAction() const     { return SprintAction; }
+	const TSoftObjectPtr<class UInputAction>& GetFlashlightAction() const { return FlashlightAction; }
+	const TSoftObjectPtr<class UInputAction>& GetInteractAction() const   { return InteractAction; }
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Headbob") 
-	float BreathPitchDeg  = 0.4f;  // camera nod in degrees
+	class UBodycamInteractionComponent* GetInteraction() const { return Interaction; }
+
+protected:
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Breathing")
-	float BreathFrequency = 1.1f;           // Hz-ish
+	//Components
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	class USceneComponent* FPCameraPivot;
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Breathing")
-	float BreathRollDeg = 0.25f;          // slight roll with breathing
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	class UCameraComponent* FPCamera;
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Breathing")
-	float BreathNoiseSpeed = 0.9f;
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Roll")
-	float StrafeRollDeg = 2.0f;             // max roll when strafing
+	//Enchanced Input (soft: streamed by UBodycamPreloadSubsystem, not loaded with the class)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Input")
+	TSoftObjectPtr<class UInputMappingContext> IMC_Player;
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Input")
+	TSoftObjectPtr<class UInputAction> MoveAction;
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Input")
+	TSoftObjectPtr<class UInputAction> LookAction;
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Input")
+	TSoftObjectPtr<class UInputAction> JumpAction;
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Roll")
-	float RollInterpSpeed = 6.0f;           // smoothing
+	//Input handlers
+	void Move(const FInputActionValue& Value);
+	void Look(const FInputActionValue& Value);
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Landing")
-	float LandingKick = 3.0f;               // cm downward kick on land
+private:
+	// the motion subsystem owns the per-frame bodycam state and reads our hot state directly
+	friend class UBodycamMotionSubsystem;
+	// drives Move / Look the way the input handlers do
+	friend class UBodycamAllocCommandlet;
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Landing")
-	float LandingDamp = 12.0f;              // how fast the kick fades
+	// ===== Tuning =====
+	// shared profile; null = UBodycamProfile defaults
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam", meta=(AllowPrivateAccess="true"))
+	TObjectPtr<UBodycamProfile> Profile;
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Landing") 
-	float JumpKickUp = 2.0f; // cm
+	// only the values this pawn changes on top of the profile
+	UPROPERTY(EditAnywhere, Category="Bodycam")
+	TArray<FBodycamTuningOverride> TuningOverrides;
 
-	UPROPERTY(EditAnywhere, Category="Bodycam|Landing") 
-	float JumpDamp   = 10.0f;
-	
-	float JumpOffset = 0.f;
+	// push profile values into movement / camera (and the motion subsystem once registered)
+	void ApplyTuning();
 
-	// runtime
-	float BobTime = 0.f;
-	float BreathTime = 0.f;
-	float LandingOffset = 0.f;              // positive = push camera down
-	bool  bWasGrounded = true;
-	FVector PivotBaseRelLoc = FVector::ZeroVector;
+	// walk / sprint speed for Hot.bIsSprinting
+	void ApplySprintSpeed();
 
-	// helper
-	void UpdateBodycamPOV(float DeltaSeconds);
+	FBodycamPawnHotState Hot;
 
-	// seeds (initialized once so each pawn drifts differently)
-	float BreathSeedX = 0.f, BreathSeedY = 0.f, BreathSeedZ = 0.f, BreathSeedPitch = 0.f, BreathSeedRoll = 0.f;
+	TUniquePtr<FBodycamLatencyTracker> LatencyTracker;
 
+	// creates / drops the tracker for bodycam.Latency.Track and local control; allocates, so it is
+	// called on BeginPlay, possession changes and by the motion subsystem when the cvar flips,
+	// never from the per-frame look path
+	void RefreshLatencyTracker();
 
+	// free-aim split over everything buffered since the last call (the old per-event Look body)
+	void ResolvePendingLook(const FBodycamTuning& T);
 
 
 	/*FLASHLIGHT AND SPRINTING IMPLEMENTATIONS*/
@@ -131,98 +172,74 @@ private:
 
 	// ===== Input =====
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Input", meta=(AllowPrivateAccess="true"))
-	class UInputAction* SprintAction = nullptr;
+	TSoftObjectPtr<class UInputAction> SprintAction;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Input", meta=(AllowPrivateAccess="true"))
-	class UInputAction* FlashlightAction = nullptr;
-
-	// ===== Sprint =====
-	UPROPERTY(EditAnywhere, Category="Movement|Sprint")
-	float WalkSpeed = 250.f;
-
-	UPROPERTY(EditAnywhere, Category="Movement|Sprint")
-	float SprintSpeed = 500.f;
+	TSoftObjectPtr<class UInputAction> FlashlightAction;
 
-	bool bIsSprinting = false;
-
-	// ===== FOV (sensor feel) =====
-	UPROPERTY(EditAnywhere, Category="Camera|FOV")
-	float BaseFOV = 95.f;
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Input", meta=(AllowPrivateAccess="true"))
+	TSoftObjectPtr<class UInputAction> InteractAction;
 
-	UPROPERTY(EditAnywhere, Category="Camera|FOV")
-	float SprintFOV = 101.f;
+	// in flight when SetupPlayerInputComponent ran before the input assets arrived
+	TSharedPtr<struct FStreamableHandle> InputAssetsHandle;
 
-	UPROPERTY(EditAnywhere, Category="Camera|FOV")
-	float FOVInterpSpeed = 6.f;
+	// mapping context + action bindings, once the input assets are loaded
+	void BindInput(class UEnhancedInputComponent* EIC);
 
 	// ===== Flashlight =====
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta=(AllowPrivateAccess="true"))
 	class USpotLightComponent* Flashlight = nullptr;
 
-	// --- Flashlight free-aim (beam moves first, then camera) ---
-	UPROPERTY(EditAnywhere, Category="Flashlight|FreeAim") float FlashAimMaxYaw   = 10.f; // deg
-	UPROPERTY(EditAnywhere, Category="Flashlight|FreeAim") float FlashAimMaxPitch = 8.f;  // deg
-	UPROPERTY(EditAnywhere, Category="Flashlight|FreeAim") float FlashAimReturnSpeed = 4.f;   // recenter
-	UPROPERTY(EditAnywhere, Category="Flashlight|FreeAim") float FlashAimSmoothing   = 12.f;  // visual smoothing
-
-	// convert look input to degrees that fill the free-aim
-	UPROPERTY(EditAnywhere, Category="Flashlight|FreeAim") float LookToDegYaw   = 1.0f;
-	UPROPERTY(EditAnywhere, Category="Flashlight|FreeAim") float LookToDegPitch = 1.0f;
+	// ===== Interaction =====
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta=(AllowPrivateAccess="true"))
+	class UBodycamInteractionComponent* Interaction = nullptr;
 
-	// Flip directions if your mouse/asset axes feel reversed
-	UPROPERTY(EditAnywhere, Category="Flashlight|FreeAim")
-	bool bInvertFlashAimPitch = true;   // try true first (mouse up -> beam up)
+	// ===== Replication =====
+	// flashlight on/off, sprint + free-aim for everyone but the owner; proxies rebuild the rest locally
+	UPROPERTY(ReplicatedUsing=OnRep_NetState)
+	FBodycamNetState NetState;
 
-	UPROPERTY(EditAnywhere, Category="Flashlight|FreeAim")
-	bool bInvertFlashAimYaw = false;    // usually fine; set true if left/right feels backwards
+	UPROPERTY(ReplicatedUsing=OnRep_MotionSeed)
+	uint16 MotionSeed = 0;
 
-	// Camera sensitivity (leftover input -> camera), independent of flashlight
-	UPROPERTY(EditAnywhere, Category="Flashlight|FreeAim")
-	float CameraYawDegPerInput   = 1.0f;   // how many degrees the CAMERA turns per 1.0 input unit (yaw)
+	FBodycamNetState LastSentNetState;
+	double LastNetSendTime = 0.0;
+	FTimerHandle NetRateTimer;
 
-	UPROPERTY(EditAnywhere, Category="Flashlight|FreeAim")
-	float CameraPitchDegPerInput = 1.0f;   // degrees per 1.0 input unit (pitch)
+	UFUNCTION()
+	void OnRep_NetState();
 
-	// Small fraction of input that always reaches the camera (prevents "stun")
-	UPROPERTY(EditAnywhere, Category="Flashlight|FreeAim", meta=(ClampMin="0.0", ClampMax="1.0"))
-	float FreeAimLeak = 0.18f;             // 0 = hard deadzone, 0.15~0.30 = soft/comfortable
+	UFUNCTION()
+	void OnRep_MotionSeed();
 
+	UFUNCTION(Server, Reliable)
+	void ServerSetFlashlight(bool bOn);
 
-	// --- Flashlight movement sway (while walking/sprinting) ---
-	UPROPERTY(EditAnywhere, Category="Flashlight|Move") 
-	float FlashMoveYawByStrafe   = 4.0f; // deg at full strafe
-	UPROPERTY(EditAnywhere, Category="Flashlight|Move") 
-	float FlashMovePitchBySpeed = 2.5f;  // deg nose-down at full forward speed
-	UPROPERTY(EditAnywhere, Category="Flashlight|Move") 
-	float FlashSprintSwayScale  = 1.35f; // extra during sprint
-	UPROPERTY(EditAnywhere, Category="Flashlight|Move") 
-	float FlashBobYaw           = 0.8f;  // tie sway to your bob phase
-	UPROPERTY(EditAnywhere, Category="Flashlight|Move") 
-	float FlashBobPitch         = 0.5f;
-	UPROPERTY(EditAnywhere, Category="Flashlight|Move") 
-	float FlashMoveInterp       = 8.0f;  // smoothing
+	UFUNCTION(Server, Reliable)
+	void ServerSetSprinting(bool bSprint);
 
-	// --- Flashlight impulses on jump/land ---
-	UPROPERTY(EditAnywhere, Category="Flashlight|Jump") 
-	float FlashJumpPitchKick   = 4.0f;   // up on takeoff (+)
-	UPROPERTY(EditAnywhere, Category="Flashlight|Jump") 
-	float FlashLandPitchKick   = -6.0f;  // dip on landing (-)
-	UPROPERTY(EditAnywhere, Category="Flashlight|Jump") 
-	float FlashKickReturnSpeed = 12.0f;  // decay
+	UFUNCTION(Server, Unreliable)
+	void ServerSetFlashlightAim(FBodycamNetState State);
 
-	// runtime (no need to expose)
-	float FlashMoveYaw = 0.f, FlashMovePitch = 0.f, FlashKickAccumPitch = 0.f;
-	bool  bFlashPrevGrounded = true;
+	// server: lower the update rate for pawns far from every player's view
+	void UpdateNetRate();
 
+	// ===== Streaming =====
+	FName StreamingSourceName;
+	FBodycamStreamingProbe StreamingProbe;
+	FTimerHandle StreamingProbeTimer;
 
+	int32 PredictStreaming(const FBodycamStreamingPrediction& Settings, FVector (&OutOffsets)[FBodycamStreamingPrediction::MaxShapes]) const;
 
-	float FlashAimYaw   = 0.f; // current offset relative to camera (deg)
-	float FlashAimPitch = 0.f; // current offset relative to camera (deg)
+	// local player only: time how long predicted cells take to load
+	void UpdateStreamingProbe();
+	void PollStreamingProbe();
 
 	// Handlers
 	void StartSprint(const struct FInputActionValue& Value);
 	void StopSprint (const struct FInputActionValue& Value);
 	void ToggleFlashlight(const struct FInputActionValue& Value);
+	void Interact(const struct FInputActionValue& Value);
 	
 
 };
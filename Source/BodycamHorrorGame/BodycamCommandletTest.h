@@ -0,0 +1,17 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BodycamHorrorGame.h"
+
+/**
+ * Check for the headless test commandlets: logs "ok: Label" or "FAILED: Label" and counts the
+ * failure in a local int32 Failures, which the commandlet returns (non-zero fails the run).
+ */
+#define BODYCAM_CHECK(Condition, Label) \
+	do \
+	{ \
+		if (!(Condition)) { UE_LOG(LogBodycam, Error, TEXT("FAILED: %s"), TEXT(Label)); ++Failures; } \
+		else { UE_LOG(LogBodycam, Display, TEXT("ok: %s"), TEXT(Label)); } \
+	} while (0)
@@ -0,0 +1,359 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamFlashlightGovernor.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamCharacter.h"
+#include "BodycamMotionSubsystem.h"
+#include "Components/SpotLightComponent.h"
+#include "Engine/World.h"
+#include "Engine/TextureLightProfile.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/IConsoleManager.h"
+#include "RenderCore.h"
+#include "RHI.h"
+
+static bool GBodycamLightBudgetEnable = true;
+static FAutoConsoleVariableRef CVarBodycamLightBudgetEnable(
+	TEXT("bodycam.LightBudget.Enable"),
+	GBodycamLightBudgetEnable,
+	TEXT("Scale flashlight quality down when the frame is over budget."));
+
+static float GBodycamLightBudgetTargetMs = 16.67f;
+static FAutoConsoleVariableRef CVarBodycamLightBudgetTargetMs(
+	TEXT("bodycam.LightBudget.TargetMs"),
+	GBodycamLightBudgetTargetMs,
+	TEXT("Render thread / GPU time budget (ms) the flashlight governor aims for."));
+
+static float GBodycamLightBudgetForceFrameMs = 0.f;
+static FAutoConsoleVariableRef CVarBodycamLightBudgetForceFrameMs(
+	TEXT("bodycam.LightBudget.ForceFrameMs"),
+	GBodycamLightBudgetForceFrameMs,
+	TEXT("If > 0, feed this frame time to the governor instead of the measured one (headless testing)."));
+
+static int32 GBodycamProximityMaxRays = 32;
+static FAutoConsoleVariableRef CVarBodycamProximityMaxRays(
+	TEXT("bodycam.Flashlight.Proximity.MaxRays"),
+	GBodycamProximityMaxRays,
+	TEXT("Proximity rays issued per frame across all flashlights; lights that do not fit wait a frame."));
+
+namespace BodycamLightSteps
+{
+	// what each step keeps of the authored value
+	static constexpr float AttenuationScale = 0.6f;
+	static constexpr float ConeScale        = 0.8f;
+
+	// proximity moves a little every frame; only push it to the light once it moved noticeably or settled
+	static constexpr float ProximityTolerance = 0.02f; // of the value
+
+	static bool NeedsUpdate(float New, float Applied, float Settled)
+	{
+		return New != Applied && (FMath::Abs(New - Applied) > FMath::Abs(Applied) * ProximityTolerance || New == Settled);
+	}
+}
+
+// ---------------------------------------------------------------------------------------------
+
+bool FBodycamLightBudget::AddSample(float FrameMs)
+{
+	SmoothedMs = (SmoothedMs <= 0.f) ? FrameMs : FMath::Lerp(SmoothedMs, FrameMs, Smoothing);
+
+	const int32 PrevLevel = Level;
+	if (SmoothedMs > TargetMs)
+	{
+		UnderCount = 0;
+		if (++OverCount >= OverBudgetFrames && Level < MaxLevel)
+		{
+			++Level;
+			OverCount = 0;
+		}
+	}
+	else if (SmoothedMs < TargetMs * RecoverRatio)
+	{
+		OverCount = 0;
+		if (++UnderCount >= RecoverFrames && Level > 0)
+		{
+			--Level;
+			UnderCount = 0;
+		}
+	}
+	else
+	{
+		// inside the hysteresis band: hold
+		OverCount = 0;
+		UnderCount = 0;
+	}
+	return Level != PrevLevel;
+}
+
+void FBodycamLightBudget::Reset()
+{
+	Level = 0;
+	SmoothedMs = 0.f;
+	OverCount = 0;
+	UnderCount = 0;
+}
+
+// ---------------------------------------------------------------------------------------------
+
+void UBodycamFlashlightGovernor::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Budget.MaxLevel = NumSteps * NumPriorityClasses;
+}
+
+void UBodycamFlashlightGovernor::RegisterLight(ABodycamCharacter* Owner, USpotLightComponent* Light)
+{
+	if (!Light || Lights.ContainsByPredicate([Light](const FGovernedLight& E) { return E.Light == Light; }))
+	{
+		return;
+	}
+	LLM_SCOPE_BYTAG(Bodycam);
+
+	FGovernedLight& Entry = Lights.AddDefaulted_GetRef();
+	Entry.Owner                = Owner;
+	Entry.Light                = Light;
+	Entry.Intensity            = Light->Intensity;
+	Entry.bCastShadows         = Light->CastShadows;
+	Entry.bCastVolumetricShadow = Light->bCastVolumetricShadow;
+	Entry.bAppliedVolumetricShadow = Light->bCastVolumetricShadow;
+	Entry.AttenuationRadius    = Light->AttenuationRadius;
+	Entry.InnerConeAngle       = Light->InnerConeAngle;
+	Entry.OuterConeAngle       = Light->OuterConeAngle;
+	Entry.VolumetricScattering = Light->VolumetricScatteringIntensity;
+	Entry.IESTexture           = Light->IESTexture;
+	Entry.AppliedRadius        = Light->AttenuationRadius;
+
+	ApplyLevel(Entry, Budget.GetLevel(), GetWorld()->GetSubsystem<UBodycamMotionSubsystem>());
+}
+
+void UBodycamFlashlightGovernor::UnregisterLight(USpotLightComponent* Light)
+{
+	Lights.RemoveAllSwap([Light](const FGovernedLight& E) { return !E.Light.IsValid() || E.Light == Light; });
+}
+
+void UBodycamFlashlightGovernor::AddFrameSample(float FrameMs)
+{
+	Budget.TargetMs = GBodycamLightBudgetTargetMs;
+	Budget.AddSample(FrameMs);
+}
+
+int32 UBodycamFlashlightGovernor::GetLightSteps(int32 BudgetLevel, int32 PriorityClass)
+{
+	// NPC lights use budget levels 1..5, remote players 6..10, locally viewed 11..15
+	const int32 ClassOffset = (NumPriorityClasses - 1 - PriorityClass) * NumSteps;
+	return FMath::Clamp(BudgetLevel - ClassOffset, 0, NumSteps);
+}
+
+int32 UBodycamFlashlightGovernor::GetPriorityClass(const ABodycamCharacter* Owner)
+{
+	if (!Owner)
+	{
+		return 2;
+	}
+	const APlayerController* PC = Cast<APlayerController>(Owner->GetController());
+	if (PC && PC->IsLocalController() && PC->GetViewTarget() == Owner)
+	{
+		return 0;
+	}
+	return Owner->GetPlayerState() ? 1 : 2;
+}
+
+void UBodycamFlashlightGovernor::ApplyLevel(FGovernedLight& Entry, int32 BudgetLevel, const UBodycamMotionSubsystem* Motion)
+{
+	const ABodycamCharacter* Owner = Entry.Owner.Get();
+	const EBodycamSignificance Significance = Motion ? Motion->GetSignificance(Owner) : EBodycamSignificance::High;
+	const int32 Steps = FMath::Max(GetLightSteps(BudgetLevel, GetPriorityClass(Owner)), FBodycamSignificance::GetLightSteps(Significance));
+	ApplySteps(Entry, Steps, Entry.bCastVolumetricShadow && FBodycamSignificance::KeepsVolumetricShadow(Significance));
+}
+
+void UBodycamFlashlightGovernor::ApplySteps(FGovernedLight& Entry, int32 Steps, bool bVolumetricShadow) const
+{
+	USpotLightComponent* Light = Entry.Light.Get();
+	if (!Light)
+	{
+		return;
+	}
+
+	const float BudgetRadius   = Steps >= 2 ? Entry.AttenuationRadius * BodycamLightSteps::AttenuationScale : Entry.AttenuationRadius;
+	const float IntensityScale = ProximitySettings.GetIntensityScale(Entry.Proximity);
+	const float ConeScale      = ProximitySettings.GetConeScale(Entry.Proximity);
+	const float Radius         = ProximitySettings.GetAttenuationRadius(Entry.Proximity, BudgetRadius);
+	const bool bProximityChanged = BodycamLightSteps::NeedsUpdate(IntensityScale, Entry.AppliedIntensityScale, 1.f)
+		|| BodycamLightSteps::NeedsUpdate(ConeScale, Entry.AppliedConeScale, 1.f)
+		|| BodycamLightSteps::NeedsUpdate(Radius, Entry.AppliedRadius, BudgetRadius);
+
+	if (Entry.AppliedSteps == Steps && Entry.bAppliedVolumetricShadow == bVolumetricShadow && !bProximityChanged)
+	{
+		return;
+	}
+	Entry.AppliedSteps = Steps;
+	Entry.bAppliedVolumetricShadow = bVolumetricShadow;
+	Entry.AppliedIntensityScale = IntensityScale;
+	Entry.AppliedConeScale = ConeScale;
+	Entry.AppliedRadius = Radius;
+
+	const float BudgetConeScale = Steps >= 3 ? BodycamLightSteps::ConeScale : 1.f;
+	Light->SetIntensity(Entry.Intensity * IntensityScale);
+	Light->SetCastVolumetricShadow(bVolumetricShadow);
+	Light->SetCastShadows(Steps >= 1 ? false : Entry.bCastShadows);
+	Light->SetAttenuationRadius(Radius);
+	Light->SetInnerConeAngle(Entry.InnerConeAngle * BudgetConeScale * ConeScale);
+	Light->SetOuterConeAngle(Entry.OuterConeAngle * BudgetConeScale * ConeScale);
+	Light->SetVolumetricScatteringIntensity(Steps >= 4 ? 0.f : Entry.VolumetricScattering);
+	Light->SetIESTexture(Steps >= 5 ? nullptr : Entry.IESTexture.Get());
+}
+
+void UBodycamFlashlightGovernor::UpdateProximity(float DeltaSeconds)
+{
+	ProximitySettings = FBodycamLightProximity::FromConsole();
+
+	UWorld* World = GetWorld();
+	const double Now = World->GetTimeSeconds();
+	DueFans.Reset();
+
+	for (int32 i = 0; i < Lights.Num(); ++i)
+	{
+		FGovernedLight& Entry = Lights[i];
+		const USpotLightComponent* Light = Entry.Light.Get();
+		if (!Light)
+		{
+			continue;
+		}
+
+		// last frame's fan (async traces are done by the next frame)
+		if (Entry.PendingFan.Num() > 0)
+		{
+			float Distances[FBodycamLightProximity::MaxRays];
+			bool bComplete = true;
+			for (int32 Ray = 0; Ray < Entry.PendingFan.Num() && bComplete; ++Ray)
+			{
+				FTraceDatum Datum;
+				bComplete = World->QueryTraceData(Entry.PendingFan[Ray], Datum);
+				const FHitResult* Hit = bComplete ? FHitResult::GetFirstBlockingHit(Datum.OutHits) : nullptr;
+				Distances[Ray] = Hit ? Hit->Distance : Entry.PendingRange;
+			}
+			if (bComplete)
+			{
+				ProximitySettings.AddFan(Entry.Proximity, MakeArrayView(Distances, Entry.PendingFan.Num()));
+			}
+			Entry.PendingFan.Reset();
+		}
+
+		// a light switched off forgets, so switching it on starts from a fresh fan and not a stale wall
+		if (!ProximitySettings.bEnabled || !Light->IsVisible() || Entry.AttenuationRadius <= 0.f)
+		{
+			Entry.Proximity = FBodycamLightProximity::FState();
+			Entry.bHasLastPose = false;
+			continue;
+		}
+		ProximitySettings.Smooth(Entry.Proximity, DeltaSeconds);
+
+		const FVector Location = Light->GetComponentLocation();
+		const FVector Forward = Light->GetForwardVector();
+		float AimSpeed = 0.f;
+		float MoveSpeed = 0.f;
+		if (Entry.bHasLastPose && DeltaSeconds > 0.f)
+		{
+			AimSpeed  = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp((float)FVector::DotProduct(Forward, Entry.LastForward), -1.f, 1.f))) / DeltaSeconds;
+			MoveSpeed = (float)FVector::Dist(Location, Entry.LastLocation) / DeltaSeconds;
+		}
+		Entry.LastLocation = Location;
+		Entry.LastForward = Forward;
+		Entry.bHasLastPose = true;
+
+		const float Interval = ProximitySettings.GetFanInterval(AimSpeed, MoveSpeed);
+		const float SinceFan = Entry.Proximity.LastFanSeconds < 0.0 ? UE_MAX_FLT : (float)(Now - Entry.Proximity.LastFanSeconds);
+		if (SinceFan >= Interval)
+		{
+			FDueFan& Due = DueFans.AddDefaulted_GetRef();
+			Due.Index = i;
+			Due.PriorityClass = GetPriorityClass(Entry.Owner.Get());
+			Due.Lateness = SinceFan - Interval;
+		}
+	}
+
+	// the light we look through first, then whoever waited longest
+	DueFans.Sort([](const FDueFan& A, const FDueFan& B)
+	{
+		return A.PriorityClass != B.PriorityClass ? A.PriorityClass < B.PriorityClass : A.Lateness > B.Lateness;
+	});
+
+	int32 RaysLeft = GBodycamProximityMaxRays;
+	for (const FDueFan& Due : DueFans)
+	{
+		FGovernedLight& Entry = Lights[Due.Index];
+		FVector Dirs[FBodycamLightProximity::MaxRays];
+		const int32 NumRays = ProximitySettings.GetRayDirections(Entry.LastForward, Entry.OuterConeAngle, Dirs);
+		if (NumRays > RaysLeft)
+		{
+			break;
+		}
+		RaysLeft -= NumRays;
+
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(BodycamLightProximity), false, Entry.Owner.Get());
+		Entry.PendingRange = Entry.AttenuationRadius;
+		for (int32 Ray = 0; Ray < NumRays; ++Ray)
+		{
+			Entry.PendingFan.Add(World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Entry.LastLocation,
+				Entry.LastLocation + Dirs[Ray] * Entry.PendingRange, ECC_Visibility, Params));
+		}
+		Entry.Proximity.LastFanSeconds = Now;
+		INC_DWORD_STAT_BY(STAT_BodycamProximityRays, NumRays);
+	}
+}
+
+float UBodycamFlashlightGovernor::GetRenderFrameMs()
+{
+	// what the lights cost: the slower of the render thread and the GPU (last finished frame).
+	// Not the world delta, which also holds vsync / frame limiter waits and would degrade a capped game.
+	const uint32 Cycles = FMath::Max(GRenderThreadTime, RHIGetGPUFrameCycles());
+	return (float)FPlatformTime::ToMilliseconds(Cycles);
+}
+
+void UBodycamFlashlightGovernor::UpdateLights()
+{
+	const int32 Level = Budget.GetLevel();
+	const UBodycamMotionSubsystem* Motion = GetWorld()->GetSubsystem<UBodycamMotionSubsystem>();
+	for (int32 i = Lights.Num() - 1; i >= 0; --i)
+	{
+		FGovernedLight& Entry = Lights[i];
+		if (!Entry.Light.IsValid())
+		{
+			Lights.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			continue;
+		}
+		ApplyLevel(Entry, Level, Motion);
+	}
+}
+
+void UBodycamFlashlightGovernor::Tick(float DeltaTime)
+{
+	BODYCAM_SCOPE(STAT_BodycamLightGovernor, BodycamLightGovernor);
+
+	if (GBodycamLightBudgetEnable)
+	{
+		AddFrameSample(GBodycamLightBudgetForceFrameMs > 0.f ? GBodycamLightBudgetForceFrameMs : GetRenderFrameMs());
+	}
+	else
+	{
+		Budget.Reset();
+	}
+
+	UpdateProximity(DeltaTime);
+
+	// view targets, significance and proximity change without the level changing, so re-rate every frame
+	UpdateLights();
+}
+
+TStatId UBodycamFlashlightGovernor::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBodycamFlashlightGovernor, STATGROUP_Bodycam);
+}
+
+bool UBodycamFlashlightGovernor::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,142 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "BodycamLightProximity.h"
+#include "BodycamFlashlightGovernor.generated.h"
+
+class ABodycamCharacter;
+class USpotLightComponent;
+class UTextureLightProfile;
+
+/**
+ * Frame-budget decision logic, kept free of the world so it can be fed synthetic samples
+ * (e.g. under -nullrhi). Level 0 = full quality; it climbs one step after OverBudgetFrames
+ * consecutive smoothed samples above the target, and drops one step after RecoverFrames
+ * consecutive samples below Target * RecoverRatio.
+ */
+struct BODYCAMHORRORGAME_API FBodycamLightBudget
+{
+	float TargetMs         = 16.67f;
+	float RecoverRatio     = 0.85f;  // hysteresis band
+	float Smoothing        = 0.1f;   // EMA weight of a new sample
+	int32 OverBudgetFrames = 10;
+	int32 RecoverFrames    = 120;
+	int32 MaxLevel         = 0;
+
+	/** Returns true when Level changed. */
+	bool AddSample(float FrameMs);
+	void Reset();
+
+	int32 GetLevel() const { return Level; }
+	float GetSmoothedMs() const { return SmoothedMs; }
+
+private:
+	int32 Level = 0;
+	float SmoothedMs = 0.f;
+	int32 OverCount = 0;
+	int32 UnderCount = 0;
+};
+
+/**
+ * Scales flashlight spotlights down when the frame is over budget, in steps:
+ * shadows, attenuation radius, cone angles, volumetric scattering, IES profile.
+ * NPC lights give up quality first, then remote players', and locally viewed lights last.
+ *
+ * Independently of the budget, the owner's significance (UBodycamMotionSubsystem) sets a floor:
+ * mid range lights drop their volumetric shadow, far ones all shadows.
+ *
+ * On top of both, every visible light adapts to the surface it points at (FBodycamLightProximity):
+ * the governor issues one batch of async trace fans per frame (bodycam.Flashlight.Proximity.MaxRays,
+ * the locally viewed light and the most overdue first) and reads them back the next frame.
+ */
+UCLASS()
+class BODYCAMHORRORGAME_API UBodycamFlashlightGovernor : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Degradation steps applied to a single light, in order. */
+	static constexpr int32 NumSteps = 5;
+
+	/** 0 = locally viewed, 1 = remote player, 2 = NPC. */
+	static constexpr int32 NumPriorityClasses = 3;
+
+	void RegisterLight(ABodycamCharacter* Owner, USpotLightComponent* Light);
+	void UnregisterLight(USpotLightComponent* Light);
+
+	/** Feed one frame time; the governor's own Tick does this with GetRenderFrameMs(). */
+	void AddFrameSample(float FrameMs);
+
+	/** Render thread or GPU time of the last frame (ms), whichever is longer; idle and vsync waits excluded. */
+	static float GetRenderFrameMs();
+
+	const FBodycamLightBudget& GetBudget() const { return Budget; }
+
+	/** Steps a light in the given priority class gets at a budget level (0..NumSteps). */
+	static int32 GetLightSteps(int32 BudgetLevel, int32 PriorityClass);
+
+	// UTickableWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FGovernedLight
+	{
+		TWeakObjectPtr<ABodycamCharacter>  Owner;
+		TWeakObjectPtr<USpotLightComponent> Light;
+
+		// authored settings, restored as the budget recovers
+		float Intensity = 0.f;
+		bool  bCastShadows = true;
+		bool  bCastVolumetricShadow = true;
+		float AttenuationRadius = 0.f;
+		float InnerConeAngle = 0.f;
+		float OuterConeAngle = 0.f;
+		float VolumetricScattering = 0.f;
+		TWeakObjectPtr<UTextureLightProfile> IESTexture;
+
+		int32 AppliedSteps = 0;
+		bool  bAppliedVolumetricShadow = true;
+
+		// proximity: smoothed distances, the fan in flight and the beam pose it was last seen at
+		FBodycamLightProximity::FState Proximity;
+		TArray<FTraceHandle, TInlineAllocator<FBodycamLightProximity::MaxRays>> PendingFan;
+		float PendingRange = 0.f;
+		FVector LastLocation = FVector::ZeroVector;
+		FVector LastForward = FVector::ForwardVector;
+		bool  bHasLastPose = false;
+		float AppliedIntensityScale = 1.f;
+		float AppliedConeScale = 1.f;
+		float AppliedRadius = 0.f;
+	};
+
+	struct FDueFan
+	{
+		int32 Index = 0;
+		int32 PriorityClass = 0;
+		float Lateness = 0.f; // s past its interval
+	};
+
+	static int32 GetPriorityClass(const ABodycamCharacter* Owner);
+	void ApplySteps(FGovernedLight& Entry, int32 Steps, bool bVolumetricShadow) const;
+
+	// budget steps for the owner's class, floored by its significance
+	void ApplyLevel(FGovernedLight& Entry, int32 BudgetLevel, const class UBodycamMotionSubsystem* Motion);
+	void UpdateLights();
+
+	// read back last frame's fans, smooth, and issue this frame's batch
+	void UpdateProximity(float DeltaSeconds);
+
+	FBodycamLightBudget Budget;
+	FBodycamLightProximity ProximitySettings;
+	TArray<FGovernedLight> Lights;
+	TArray<FDueFan> DueFans; // scratch
+};
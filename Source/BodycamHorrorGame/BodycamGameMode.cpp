@@ -3,9 +3,35 @@
 
 #include "BodycamGameMode.h"
 #include "BodycamCharacter.h"
+#include "BodycamPreload.h"
+#include "Engine/GameInstance.h"
 
 ABodycamGameMode::ABodycamGameMode(const FObjectInitializer &ObjectInitializer)
 {
     // set default pawn class to our character
     DefaultPawnClass = ABodycamCharacter::StaticClass();
 }
+
+UClass* ABodycamGameMode::GetDefaultPawnClassForController_Implementation(AController* InController)
+{
+	// the preloaded soft class wins, so nothing has to hard reference the pawn blueprint
+	if (UBodycamPreloadSubsystem* Preload = UGameInstance::GetSubsystem<UBodycamPreloadSubsystem>(GetGameInstance()))
+	{
+		if (UClass* PawnClass = Preload->ResolvePawnClass())
+		{
+			return PawnClass;
+		}
+	}
+	return Super::GetDefaultPawnClassForController_Implementation(InController);
+}
+
+APawn* ABodycamGameMode::SpawnDefaultPawnAtTransform_Implementation(AController* NewPlayer, const FTransform& SpawnTransform)
+{
+	const double Start = FPlatformTime::Seconds();
+	APawn* Pawn = Super::SpawnDefaultPawnAtTransform_Implementation(NewPlayer, SpawnTransform);
+	if (UBodycamPreloadSubsystem* Preload = UGameInstance::GetSubsystem<UBodycamPreloadSubsystem>(GetGameInstance()))
+	{
+		Preload->NotifyPawnSpawned(FPlatformTime::Seconds() - Start);
+	}
+	return Pawn;
+}
@@ -7,7 +7,8 @@
 #include "BodycamGameMode.generated.h"
 
 /**
- * 
+ * Spawns the pawn class UBodycamPreloadSubsystem streamed in at startup (falls back to
+ * DefaultPawnClass when none is configured).
  */
 UCLASS()
 class BODYCAMHORRORGAME_API ABodycamGameMode : public AGameModeBase
@@ -16,4 +17,7 @@ class BODYCAMHORRORGAME_API ABodycamGameMode : public AGameModeBase
 	
 public:
 	ABodycamGameMode(const FObjectInitializer& ObjectInitializer);
+
+	virtual UClass* GetDefaultPawnClassForController_Implementation(AController* InController) override;
+	virtual APawn* SpawnDefaultPawnAtTransform_Implementation(AController* NewPlayer, const FTransform& SpawnTransform) override;
 };
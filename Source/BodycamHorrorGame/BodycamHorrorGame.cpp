@@ -3,4 +3,57 @@
 #include "BodycamHorrorGame.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_LOG_CATEGORY(LogBodycam);
+
+UE_TRACE_CHANNEL_DEFINE(BodycamChannel);
+
+CSV_DEFINE_CATEGORY_MODULE(BODYCAMHORRORGAME_API, Bodycam, true);
+
+LLM_DEFINE_TAG(Bodycam);
+LLM_DEFINE_TAG(Bodycam_Character, TEXT("Character"), TEXT("Bodycam"));
+
+DEFINE_STAT(STAT_BodycamMotionUpdate);
+DEFINE_STAT(STAT_BodycamGather);
+DEFINE_STAT(STAT_BodycamPOV);
+DEFINE_STAT(STAT_BodycamFlashlightSway);
+DEFINE_STAT(STAT_BodycamFOV);
+DEFINE_STAT(STAT_BodycamApply);
+DEFINE_STAT(STAT_BodycamCameraModifier);
+DEFINE_STAT(STAT_BodycamLook);
+DEFINE_STAT(STAT_BodycamMove);
+DEFINE_STAT(STAT_BodycamLightGovernor);
+DEFINE_STAT(STAT_BodycamLitQuery);
+DEFINE_STAT(STAT_BodycamAudio);
+DEFINE_STAT(STAT_BodycamInteraction);
+
+DEFINE_STAT(STAT_BodycamTransformsIssued);
+DEFINE_STAT(STAT_BodycamTransformsSkipped);
+DEFINE_STAT(STAT_BodycamActiveLights);
+DEFINE_STAT(STAT_BodycamInputEvents);
+DEFINE_STAT(STAT_BodycamLitCandidates);
+DEFINE_STAT(STAT_BodycamLitTraces);
+DEFINE_STAT(STAT_BodycamFootsteps);
+DEFINE_STAT(STAT_BodycamVoiceSteals);
+DEFINE_STAT(STAT_BodycamPawnsStepped);
+DEFINE_STAT(STAT_BodycamPawnsDormant);
+DEFINE_STAT(STAT_BodycamProximityRays);
+DEFINE_STAT(STAT_BodycamInteractCandidates);
+DEFINE_STAT(STAT_BodycamInteractTraces);
+DEFINE_STAT(STAT_BodycamPredictedLoadMs);
+DEFINE_STAT(STAT_BodycamPredictedLoads);
+DEFINE_STAT(STAT_BodycamLookToControllerMs);
+DEFINE_STAT(STAT_BodycamLookToFlashlightMs);
+DEFINE_STAT(STAT_BodycamLookToViewMs);
+DEFINE_STAT(STAT_BodycamLightSettleMs);
+
+TRACE_DECLARE_INT_COUNTER(BodycamTransformsIssued,  TEXT("Bodycam/TransformUpdatesIssued"));
+TRACE_DECLARE_INT_COUNTER(BodycamTransformsSkipped, TEXT("Bodycam/TransformUpdatesSkipped"));
+TRACE_DECLARE_INT_COUNTER(BodycamActiveLights,      TEXT("Bodycam/ActiveFlashlights"));
+TRACE_DECLARE_FLOAT_COUNTER(BodycamLookToResolveMs,    TEXT("Bodycam/Latency/LookToResolveMs"));
+TRACE_DECLARE_FLOAT_COUNTER(BodycamLookToControllerMs, TEXT("Bodycam/Latency/LookToControllerMs"));
+TRACE_DECLARE_FLOAT_COUNTER(BodycamLookToFlashlightMs, TEXT("Bodycam/Latency/LookToFlashlightMs"));
+TRACE_DECLARE_FLOAT_COUNTER(BodycamLookToViewMs,       TEXT("Bodycam/Latency/LookToViewMs"));
+TRACE_DECLARE_FLOAT_COUNTER(BodycamLightSettleMs,      TEXT("Bodycam/Latency/LightSettleMs"));
+TRACE_DECLARE_FLOAT_COUNTER(BodycamAimRecenterMs,      TEXT("Bodycam/Latency/AimRecenterMs"));
+
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, BodycamHorrorGame, "BodycamHorrorGame" );
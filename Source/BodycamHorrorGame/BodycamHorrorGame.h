@@ -3,4 +3,78 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "HAL/LowLevelMemTracker.h"
 
+DECLARE_LOG_CATEGORY_EXTERN(LogBodycam, Log, All);
+
+// Insights: -trace=default,bodycam (scopes below cost one branch while the channel is off)
+UE_TRACE_CHANNEL_EXTERN(BodycamChannel, BODYCAMHORRORGAME_API);
+
+// CSV profiler (-csvprofile, or the route regression run): Bodycam/<scope> timings
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(BODYCAMHORRORGAME_API, Bodycam);
+
+// LLM (-llm, `stat LLM`, Insights memory): the module's subsystems under Bodycam, the character's own allocations under Bodycam/Character
+LLM_DECLARE_TAG_API(Bodycam, BODYCAMHORRORGAME_API);
+LLM_DECLARE_TAG_API(Bodycam_Character, BODYCAMHORRORGAME_API);
+
+// `stat bodycam`
+DECLARE_STATS_GROUP(TEXT("Bodycam"), STATGROUP_Bodycam, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Motion Update"),       STAT_BodycamMotionUpdate,   STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Gather"),              STAT_BodycamGather,         STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("POV"),                 STAT_BodycamPOV,            STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Flashlight Sway"),     STAT_BodycamFlashlightSway, STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("FOV"),                 STAT_BodycamFOV,            STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Transforms"),    STAT_BodycamApply,          STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Camera Modifier"),     STAT_BodycamCameraModifier, STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Look Input"),          STAT_BodycamLook,           STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Move Input"),          STAT_BodycamMove,           STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Flashlight Governor"), STAT_BodycamLightGovernor,  STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Lit Query"),           STAT_BodycamLitQuery,       STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Audio"),               STAT_BodycamAudio,          STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Interaction Focus"),   STAT_BodycamInteraction,    STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Transform Updates Issued"),  STAT_BodycamTransformsIssued,  STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Transform Updates Skipped"), STAT_BodycamTransformsSkipped, STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Flashlights"),        STAT_BodycamActiveLights,      STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Input Events"),              STAT_BodycamInputEvents,       STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Lit Query Candidates"),      STAT_BodycamLitCandidates,     STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Lit Query Traces"),          STAT_BodycamLitTraces,         STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Footsteps"),                 STAT_BodycamFootsteps,         STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Voices Stolen"),             STAT_BodycamVoiceSteals,       STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pawns Stepped"),             STAT_BodycamPawnsStepped,      STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pawns Dormant"),             STAT_BodycamPawnsDormant,      STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Flashlight Proximity Rays"), STAT_BodycamProximityRays,     STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Interaction Candidates"),    STAT_BodycamInteractCandidates, STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Interaction Traces"),        STAT_BodycamInteractTraces,    STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+
+// streaming probes finish every few seconds at most, so these hold their value between frames
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Predicted Cell Load (ms)"), STAT_BodycamPredictedLoadMs, STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Predicted Cell Loads"),     STAT_BodycamPredictedLoads,  STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+
+// bodycam.Latency.Track: oldest look event of the frame to each stage, and the flashlight settle time
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Look to Controller (ms)"), STAT_BodycamLookToControllerMs, STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Look to Flashlight (ms)"), STAT_BodycamLookToFlashlightMs, STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Look to View (ms)"),       STAT_BodycamLookToViewMs,       STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Flashlight Settle (ms)"), STAT_BodycamLightSettleMs,  STATGROUP_Bodycam, BODYCAMHORRORGAME_API);
+
+TRACE_DECLARE_INT_COUNTER_EXTERN(BodycamTransformsIssued);
+TRACE_DECLARE_INT_COUNTER_EXTERN(BodycamTransformsSkipped);
+TRACE_DECLARE_INT_COUNTER_EXTERN(BodycamActiveLights);
+TRACE_DECLARE_FLOAT_COUNTER_EXTERN(BodycamLookToResolveMs);
+TRACE_DECLARE_FLOAT_COUNTER_EXTERN(BodycamLookToControllerMs);
+TRACE_DECLARE_FLOAT_COUNTER_EXTERN(BodycamLookToFlashlightMs);
+TRACE_DECLARE_FLOAT_COUNTER_EXTERN(BodycamLookToViewMs);
+TRACE_DECLARE_FLOAT_COUNTER_EXTERN(BodycamLightSettleMs);
+TRACE_DECLARE_FLOAT_COUNTER_EXTERN(BodycamAimRecenterMs);
+
+// cycle stat + Insights timing scope on the Bodycam channel + CSV profiler timing
+#define BODYCAM_SCOPE(Stat, Name) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, BodycamChannel); \
+	CSV_SCOPED_TIMING_STAT(Bodycam, Name)
@@ -0,0 +1,285 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamInteraction.h"
+#include "BodycamHorrorGame.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+
+static float GBodycamInteractDistance = 220.f;
+static FAutoConsoleVariableRef CVarBodycamInteractDistance(
+	TEXT("bodycam.Interact.Distance"),
+	GBodycamInteractDistance,
+	TEXT("How far (cm) from the view an interactable can be focused."));
+
+static float GBodycamInteractAngle = 20.f;
+static FAutoConsoleVariableRef CVarBodycamInteractAngle(
+	TEXT("bodycam.Interact.Angle"),
+	GBodycamInteractAngle,
+	TEXT("How far (deg) off the view axis an interactable can be focused."));
+
+static float GBodycamInteractMaxCacheSeconds = 0.5f;
+static FAutoConsoleVariableRef CVarBodycamInteractMaxCacheSeconds(
+	TEXT("bodycam.Interact.MaxCacheSeconds"),
+	GBodycamInteractMaxCacheSeconds,
+	TEXT("Focus is checked again after this long even when the view holds still."));
+
+namespace BodycamInteraction
+{
+	static constexpr float CellSize = 400.f; // cm, about twice the focus distance
+}
+
+FBodycamFocusSelector FBodycamFocusSelector::FromConsole()
+{
+	FBodycamFocusSelector S;
+	S.MaxDistance     = FMath::Max(1.f, GBodycamInteractDistance);
+	S.MaxAngleDeg     = FMath::Clamp(GBodycamInteractAngle, 1.f, 80.f);
+	S.MaxCacheSeconds = GBodycamInteractMaxCacheSeconds;
+	return S;
+}
+
+float FBodycamFocusSelector::Score(const FVector& ViewLoc, const FVector& ViewDir, const FVector& Target, float Radius) const
+{
+	const FVector ToTarget = Target - ViewLoc;
+	const float Dist = (float)ToTarget.Size();
+	const float DistEff = FMath::Max(0.f, Dist - Radius);
+	if (DistEff > MaxDistance)
+	{
+		return -1.f;
+	}
+
+	// angle to the nearest point of the target: pull it toward the axis by its radius (0 inside it)
+	float AngleDeg = 0.f;
+	if (Dist > Radius)
+	{
+		const float Along = (float)FVector::DotProduct(ToTarget, ViewDir);
+		if (Along <= 0.f)
+		{
+			return -1.f;
+		}
+		const float Perp = FMath::Sqrt(FMath::Max(0.f, Dist * Dist - Along * Along));
+		AngleDeg = FMath::RadiansToDegrees(FMath::Atan2(FMath::Max(0.f, Perp - Radius), Along));
+		if (AngleDeg > MaxAngleDeg)
+		{
+			return -1.f;
+		}
+	}
+
+	return AngleWeight * (1.f - AngleDeg / MaxAngleDeg) + (1.f - AngleWeight) * (1.f - DistEff / MaxDistance);
+}
+
+bool FBodycamFocusSelector::HasViewMoved(const FVector& FromLoc, const FVector& FromDir, const FVector& ToLoc, const FVector& ToDir) const
+{
+	if (FVector::DistSquared(FromLoc, ToLoc) > FMath::Square(RefreshMoveCm))
+	{
+		return true;
+	}
+	return FVector::DotProduct(FromDir, ToDir) < FMath::Cos(FMath::DegreesToRadians(RefreshTurnDeg));
+}
+
+FBox FBodycamFocusSelector::GetQueryBox(const FVector& ViewLoc, float MaxRadius) const
+{
+	return FBox(ViewLoc, ViewLoc).ExpandBy(MaxDistance + MaxRadius);
+}
+
+//------------------------------------------------------------------------------------------------
+
+UBodycamInteractableComponent::UBodycamInteractableComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	// the subsystem only hears about moves, it never polls
+	bWantsOnUpdateTransform = true;
+}
+
+void UBodycamInteractableComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UBodycamInteractionSubsystem* Interaction = GetWorld()->GetSubsystem<UBodycamInteractionSubsystem>())
+	{
+		Interaction->RegisterInteractable(this);
+	}
+}
+
+void UBodycamInteractableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UBodycamInteractionSubsystem* Interaction = GetWorld()->GetSubsystem<UBodycamInteractionSubsystem>())
+	{
+		Interaction->UnregisterInteractable(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UBodycamInteractableComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+
+	NotifyChanged();
+}
+
+void UBodycamInteractableComponent::SetInteractionEnabled(bool bEnabled)
+{
+	if (bInteractionEnabled != bEnabled)
+	{
+		bInteractionEnabled = bEnabled;
+		NotifyChanged();
+	}
+}
+
+void UBodycamInteractableComponent::SetFocusRadius(float NewRadius)
+{
+	NewRadius = FMath::Max(0.f, NewRadius);
+	if (FocusRadius != NewRadius)
+	{
+		FocusRadius = NewRadius;
+		NotifyChanged();
+	}
+}
+
+void UBodycamInteractableComponent::NotifyChanged()
+{
+	if (HasBegunPlay())
+	{
+		if (UBodycamInteractionSubsystem* Interaction = GetWorld()->GetSubsystem<UBodycamInteractionSubsystem>())
+		{
+			Interaction->UpdateInteractable(this);
+		}
+	}
+}
+
+void UBodycamInteractableComponent::Interact(APawn* Instigator)
+{
+	if (bInteractionEnabled)
+	{
+		OnInteract.Broadcast(Instigator);
+	}
+}
+
+//------------------------------------------------------------------------------------------------
+
+void UBodycamInteractionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Hash = FBodycamSpatialHash(BodycamInteraction::CellSize);
+}
+
+void UBodycamInteractionSubsystem::RegisterInteractable(UBodycamInteractableComponent* Interactable)
+{
+	if (!Interactable)
+	{
+		return;
+	}
+	if (IndexByComponent.Contains(Interactable))
+	{
+		UpdateInteractable(Interactable);
+		return;
+	}
+	LLM_SCOPE_BYTAG(Bodycam);
+
+	const FVector Loc = Interactable->GetComponentLocation();
+	const int32 Index = Hash.Add(Loc);
+	Interactables.Add(Interactable);
+	PosX.Add((float)Loc.X);
+	PosY.Add((float)Loc.Y);
+	PosZ.Add((float)Loc.Z);
+	Radius.Add(Interactable->GetFocusRadius());
+	bEnabled.Add(Interactable->IsInteractionEnabled());
+	IndexByComponent.Add(Interactable, Index);
+	MaxRadius = FMath::Max(MaxRadius, Interactable->GetFocusRadius());
+	++Version;
+	check(Interactables.Num() == Hash.Num());
+}
+
+void UBodycamInteractionSubsystem::UnregisterInteractable(UBodycamInteractableComponent* Interactable)
+{
+	if (const int32* Index = IndexByComponent.Find(Interactable))
+	{
+		RemoveAt(*Index);
+	}
+}
+
+void UBodycamInteractionSubsystem::RemoveAt(int32 Index)
+{
+	IndexByComponent.Remove(Interactables[Index]);
+	Hash.RemoveAtSwap(Index);
+
+	auto RemoveSwap = [Index](auto& Array) { Array.RemoveAtSwap(Index, 1, EAllowShrinking::No); };
+	RemoveSwap(Interactables);
+	RemoveSwap(PosX);
+	RemoveSwap(PosY);
+	RemoveSwap(PosZ);
+	RemoveSwap(Radius);
+	RemoveSwap(bEnabled);
+
+	// the last interactable now lives in the freed slot
+	if (Interactables.IsValidIndex(Index))
+	{
+		IndexByComponent.Add(Interactables[Index], Index);
+	}
+	++Version;
+}
+
+void UBodycamInteractionSubsystem::UpdateInteractable(UBodycamInteractableComponent* Interactable)
+{
+	const int32* Found = IndexByComponent.Find(Interactable);
+	if (!Found)
+	{
+		return;
+	}
+	const int32 i = *Found;
+	const FVector Loc = Interactable->GetComponentLocation();
+	PosX[i] = (float)Loc.X;
+	PosY[i] = (float)Loc.Y;
+	PosZ[i] = (float)Loc.Z;
+	Radius[i] = Interactable->GetFocusRadius();
+	bEnabled[i] = Interactable->IsInteractionEnabled();
+	Hash.Update(i, Loc);
+	MaxRadius = FMath::Max(MaxRadius, Radius[i]);
+	++Version;
+}
+
+void UBodycamInteractionSubsystem::FindCandidates(const FBodycamFocusSelector& Selector, const FVector& ViewLoc, const FVector& ViewDir, TArray<FBodycamFocusCandidate>& OutCandidates)
+{
+	OutCandidates.Reset();
+	QueryIndices.Reset();
+	Hash.Query(Selector.GetQueryBox(ViewLoc, MaxRadius), QueryIndices);
+	INC_DWORD_STAT_BY(STAT_BodycamInteractCandidates, QueryIndices.Num());
+
+	for (int32 i : QueryIndices)
+	{
+		if (!bEnabled[i])
+		{
+			continue;
+		}
+		const FVector Loc(PosX[i], PosY[i], PosZ[i]);
+		const float Score = Selector.Score(ViewLoc, ViewDir, Loc, Radius[i]);
+		if (Score < 0.f)
+		{
+			continue;
+		}
+		UBodycamInteractableComponent* Interactable = Interactables[i].ResolveObjectPtr();
+		if (!Interactable)
+		{
+			continue;
+		}
+		FBodycamFocusCandidate& Candidate = OutCandidates.AddDefaulted_GetRef();
+		Candidate.Interactable = Interactable;
+		Candidate.Location = Loc;
+		Candidate.Score = Score;
+	}
+
+	OutCandidates.Sort([](const FBodycamFocusCandidate& A, const FBodycamFocusCandidate& B) { return A.Score > B.Score; });
+	if (OutCandidates.Num() > Selector.MaxCandidates)
+	{
+		OutCandidates.SetNum(FMath::Max(0, Selector.MaxCandidates), EAllowShrinking::No);
+	}
+}
+
+bool UBodycamInteractionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
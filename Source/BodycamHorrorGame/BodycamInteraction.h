@@ -0,0 +1,149 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BodycamSpatialHash.h"
+#include "BodycamInteraction.generated.h"
+
+class APawn;
+
+/**
+ * Focus selection, world-free: which interactable the view is on and when that needs another
+ * look. A target scores by how close to the view axis (its nearest point, pulled in by its
+ * radius) and how near it is; anything past MaxDistance, outside MaxAngleDeg or behind the
+ * view is out. The focus is kept until the view moves or turns past the refresh thresholds, the
+ * interactables change, or MaxCacheSeconds pass (a door closing in front of a held view).
+ */
+struct BODYCAMHORRORGAME_API FBodycamFocusSelector
+{
+	float MaxDistance = 220.f;        // cm to the target's near side
+	float MaxAngleDeg = 20.f;
+	float AngleWeight = 0.75f;        // of the score; the rest is distance
+	float RefreshMoveCm = 4.f;
+	float RefreshTurnDeg = 1.5f;
+	float MaxCacheSeconds = 0.5f;
+	int32 MaxCandidates = 8;          // ranked targets kept per resolve (traced best first, one per update)
+
+	/** Current bodycam.Interact.* values. */
+	static FBodycamFocusSelector FromConsole();
+
+	/** 0..1, higher is better; < 0 when the target is out. ViewDir is unit length. */
+	float Score(const FVector& ViewLoc, const FVector& ViewDir, const FVector& Target, float Radius) const;
+
+	/** Past the refresh thresholds? Directions are unit length. */
+	bool HasViewMoved(const FVector& FromLoc, const FVector& FromDir, const FVector& ToLoc, const FVector& ToDir) const;
+
+	/** Box around everything Score could accept, for targets up to MaxRadius. */
+	FBox GetQueryBox(const FVector& ViewLoc, float MaxRadius) const;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FBodycamInteractSignature, APawn*, Instigator);
+
+/**
+ * Something the player can use (door, switch, pickup). The component's location is the focus
+ * point, so place it on the handle. It registers with UBodycamInteractionSubsystem while in
+ * play and updates its entry only when it is moved, never per frame.
+ */
+UCLASS(ClassGroup=(Bodycam), meta=(BlueprintSpawnableComponent))
+class BODYCAMHORRORGAME_API UBodycamInteractableComponent : public USceneComponent
+{
+	GENERATED_BODY()
+
+public:
+	UBodycamInteractableComponent();
+
+	/** Called on the server (or standalone) when a pawn uses this. */
+	UPROPERTY(BlueprintAssignable, Category="Bodycam|Interaction")
+	FBodycamInteractSignature OnInteract;
+
+	UFUNCTION(BlueprintCallable, Category="Bodycam|Interaction")
+	void SetInteractionEnabled(bool bEnabled);
+
+	UFUNCTION(BlueprintPure, Category="Bodycam|Interaction")
+	bool IsInteractionEnabled() const { return bInteractionEnabled; }
+
+	UFUNCTION(BlueprintCallable, Category="Bodycam|Interaction")
+	void SetFocusRadius(float NewRadius);
+
+	float GetFocusRadius() const { return FocusRadius; }
+	const FText& GetPrompt() const { return Prompt; }
+
+	virtual void Interact(APawn* Instigator);
+
+	// UActorComponent
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+protected:
+	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport) override;
+
+	// pushes location / radius / enabled into the subsystem's entry
+	void NotifyChanged();
+
+	/** Size (cm) of what the player aims at; bigger targets are easier to focus. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Interaction", meta=(ClampMin="0"))
+	float FocusRadius = 20.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Interaction")
+	FText Prompt;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Interaction")
+	bool bInteractionEnabled = true;
+};
+
+/** A ranked focus candidate (best first). */
+struct FBodycamFocusCandidate
+{
+	TWeakObjectPtr<UBodycamInteractableComponent> Interactable;
+	FVector Location = FVector::ZeroVector;
+	float Score = 0.f;
+};
+
+/**
+ * Every interactable in the world, in a spatial hash. Focus queries pull only the cells around
+ * the view and score the enabled entries there, so their cost follows what is near the player,
+ * not how many interactables the level has. No tick: entries change on register, move and
+ * enable only, and each change bumps GetVersion() so cached focus knows to look again.
+ */
+UCLASS()
+class BODYCAMHORRORGAME_API UBodycamInteractionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void RegisterInteractable(UBodycamInteractableComponent* Interactable);
+	void UnregisterInteractable(UBodycamInteractableComponent* Interactable);
+
+	/** Location, radius or enabled state changed. */
+	void UpdateInteractable(UBodycamInteractableComponent* Interactable);
+
+	/** Enabled interactables the selector accepts from this view, best first, at most MaxCandidates. */
+	void FindCandidates(const FBodycamFocusSelector& Selector, const FVector& ViewLoc, const FVector& ViewDir, TArray<FBodycamFocusCandidate>& OutCandidates);
+
+	uint32 GetVersion() const { return Version; }
+	int32 GetNumInteractables() const { return Interactables.Num(); }
+
+	// UWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void RemoveAt(int32 Index);
+
+	// interactables (struct-of-arrays, indices shared with Hash)
+	TArray<TObjectKey<UBodycamInteractableComponent>> Interactables;
+	TArray<float> PosX, PosY, PosZ, Radius;
+	TArray<uint8> bEnabled;
+	TMap<TObjectKey<UBodycamInteractableComponent>, int32> IndexByComponent;
+	FBodycamSpatialHash Hash;
+	float MaxRadius = 0.f;
+	uint32 Version = 0;
+
+	// scratch, kept between queries so they do not allocate
+	TArray<int32> QueryIndices;
+};
@@ -0,0 +1,284 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamInteractionCommandlet.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamBenchmarkCommandlet.h"
+#include "BodycamCommandletTest.h"
+#include "BodycamCharacter.h"
+#include "BodycamInteraction.h"
+#include "BodycamInteractionComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "Components/StaticMeshComponent.h"
+#include "GameFramework/PlayerController.h"
+
+namespace BodycamInteractionTest
+{
+	static constexpr float Dt = 1.f / 60.f;
+	static constexpr float EyeHeight = 160.f;
+	static constexpr float GridSpacing = 150.f;   // cm between interactables in the scale run
+	static constexpr int32 FramesPerUpdate = 4;   // 15 Hz focus updates, like bodycam.Interact.Rate
+	static constexpr int32 SettleFrames = 10;     // enough for a few traces to land
+	static constexpr int32 Seed = 1337;
+}
+
+UBodycamInteractionCommandlet::UBodycamInteractionCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UBodycamInteractionCommandlet::Main(const FString& Params)
+{
+	int32 Count = 5000;
+	int32 Frames = 600;
+	FParse::Value(*Params, TEXT("Count="), Count);
+	FParse::Value(*Params, TEXT("Frames="), Frames);
+
+	int32 Failures = RunScoring();
+	Failures += RunWorld();
+	Failures += RunScale(FMath::Max(1, Count), FMath::Max(1, Frames));
+
+	if (Failures > 0)
+	{
+		UE_LOG(LogBodycam, Error, TEXT("Interaction: %d check(s) failed"), Failures);
+		return 1;
+	}
+	UE_LOG(LogBodycam, Display, TEXT("Interaction: all checks passed"));
+	return 0;
+}
+
+int32 UBodycamInteractionCommandlet::RunScoring()
+{
+	int32 Failures = 0;
+	const FBodycamFocusSelector S;
+	const FVector Eye = FVector::ZeroVector;
+	const FVector Fwd = FVector::ForwardVector;
+
+	BODYCAM_CHECK(S.Score(Eye, Fwd, FVector(100.f, 0.f, 0.f), 10.f) > S.Score(Eye, Fwd, FVector(100.f, 30.f, 0.f), 10.f), "centred beats off-axis");
+	BODYCAM_CHECK(S.Score(Eye, Fwd, FVector(60.f, 0.f, 0.f), 10.f) > S.Score(Eye, Fwd, FVector(180.f, 0.f, 0.f), 10.f), "near beats far");
+	BODYCAM_CHECK(S.Score(Eye, Fwd, FVector(S.MaxDistance + 50.f, 0.f, 0.f), 10.f) < 0.f, "past max distance is out");
+	BODYCAM_CHECK(S.Score(Eye, Fwd, FVector(-100.f, 0.f, 0.f), 10.f) < 0.f, "behind the view is out");
+	BODYCAM_CHECK(S.Score(Eye, Fwd, FVector(100.f, 100.f, 0.f), 10.f) < 0.f, "outside the cone is out");
+	BODYCAM_CHECK(S.Score(Eye, Fwd, FVector(100.f, 40.f, 0.f), 30.f) >= 0.f, "a big target reaches into the cone");
+	BODYCAM_CHECK(S.Score(Eye, Fwd, FVector(-5.f, 0.f, 0.f), 20.f) >= 0.f, "inside a target counts as on it");
+
+	const FVector Turned = FRotator(0.f, S.RefreshTurnDeg * 0.5f, 0.f).Vector();
+	const FVector TurnedFar = FRotator(0.f, S.RefreshTurnDeg * 2.f, 0.f).Vector();
+	BODYCAM_CHECK(!S.HasViewMoved(Eye, Fwd, FVector(S.RefreshMoveCm * 0.5f, 0.f, 0.f), Turned), "jitter keeps the cache");
+	BODYCAM_CHECK(S.HasViewMoved(Eye, Fwd, FVector(S.RefreshMoveCm * 2.f, 0.f, 0.f), Fwd), "a step refreshes");
+	BODYCAM_CHECK(S.HasViewMoved(Eye, Fwd, Eye, TurnedFar), "a turn refreshes");
+	return Failures;
+}
+
+int32 UBodycamInteractionCommandlet::RunWorld()
+{
+	using namespace BodycamInteractionTest;
+
+	int32 Failures = 0;
+	UWorld* World = UBodycamBenchmarkCommandlet::CreateBenchmarkWorld(TEXT("BodycamInteraction"));
+	if (!World)
+	{
+		UE_LOG(LogBodycam, Error, TEXT("FAILED: could not create the test world"));
+		return 1;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	APlayerController* PC = World->SpawnActor<APlayerController>(APlayerController::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+	ABodycamCharacter* Pawn = World->SpawnActor<ABodycamCharacter>(ABodycamCharacter::StaticClass(), FVector(0.f, 0.f, 100.f), FRotator::ZeroRotator, SpawnParams);
+	UBodycamInteractionComponent* Interaction = Pawn ? Pawn->GetInteraction() : nullptr;
+	if (!PC || !Interaction)
+	{
+		UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+		UE_LOG(LogBodycam, Error, TEXT("FAILED: could not spawn the test pawn"));
+		return 1;
+	}
+	PC->Possess(Pawn);
+
+	// the views below are driven by hand
+	Interaction->SetComponentTickEnabled(false);
+
+	// A dead ahead behind a wall (scores best), B slightly off-axis in front of it
+	const FVector Eye(0.f, 0.f, EyeHeight);
+	UBodycamInteractableComponent* Occluded = SpawnInteractable(World, FVector(150.f, 0.f, EyeHeight), 20.f);
+	UBodycamInteractableComponent* Visible  = SpawnInteractable(World, FVector(80.f, 25.f, EyeHeight), 20.f);
+	if (UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")))
+	{
+		AStaticMeshActor* Wall = World->SpawnActor<AStaticMeshActor>(FVector(110.f, 0.f, EyeHeight), FRotator::ZeroRotator, SpawnParams);
+		Wall->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
+		Wall->GetStaticMeshComponent()->SetStaticMesh(Cube);
+		Wall->SetActorScale3D(FVector(0.1f, 2.f, 3.f));
+	}
+	Visible->OnInteract.AddDynamic(this, &UBodycamInteractionCommandlet::OnInteracted);
+
+	auto Step = [&](const FVector& ViewLoc, const FVector& ViewDir, int32 NumFrames)
+	{
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Interaction->UpdateFocus(ViewLoc, ViewDir, World->GetTimeSeconds());
+			World->Tick(LEVELTICK_All, Dt);
+			++GFrameCounter;
+		}
+	};
+
+	const FBodycamFocusSelector Selector = FBodycamFocusSelector::FromConsole();
+	BODYCAM_CHECK(Selector.Score(Eye, FVector::ForwardVector, Occluded->GetComponentLocation(), 20.f) > Selector.Score(Eye, FVector::ForwardVector, Visible->GetComponentLocation(), 20.f),
+		"occluded target scores better");
+
+	Step(Eye, FVector::ForwardVector, SettleFrames);
+	BODYCAM_CHECK(Interaction->GetFocus() == Visible, "the visible target gets the focus over the occluded one");
+
+	// held still: only the cache age brings on traces (two per look: the occluded one, then the visible one)
+	const uint32 TracesBefore = Interaction->GetNumTraces();
+	const int32 HoldFrames = 120;
+	Step(Eye, FVector::ForwardVector, HoldFrames);
+	const uint32 HeldTraces = Interaction->GetNumTraces() - TracesBefore;
+	const uint32 MaxHeldTraces = 2 * (FMath::CeilToInt(HoldFrames * Dt / FMath::Max(Selector.MaxCacheSeconds, Dt)) + 1);
+	UE_LOG(LogBodycam, Display, TEXT("  %u traces over %d held frames"), HeldTraces, HoldFrames);
+	BODYCAM_CHECK(HeldTraces <= MaxHeldTraces, "a held view reuses the cached focus");
+	BODYCAM_CHECK(Interaction->GetFocus() == Visible, "the focus survives the held view");
+
+	NumInteracts = 0;
+	BODYCAM_CHECK(Interaction->Interact() && NumInteracts == 1, "interact uses the focused target");
+
+	Step(Eye, FVector::BackwardVector, SettleFrames);
+	BODYCAM_CHECK(Interaction->GetFocus() == nullptr, "turning away drops the focus");
+
+	Step(Eye, FVector::ForwardVector, SettleFrames);
+	Visible->SetInteractionEnabled(false);
+	Step(Eye, FVector::ForwardVector, SettleFrames);
+	BODYCAM_CHECK(Interaction->GetFocus() == nullptr, "a disabled target loses the focus and the occluded one never gets it");
+	BODYCAM_CHECK(!Interaction->Interact(), "interact with nothing in focus does nothing");
+
+	Visible->SetInteractionEnabled(true);
+	Visible->SetWorldLocation(FVector(80.f, -25.f, EyeHeight));
+	Step(Eye, FVector::ForwardVector, SettleFrames);
+	BODYCAM_CHECK(Interaction->GetFocus() == Visible, "a moved target is found at its new place");
+
+	UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+	return Failures;
+}
+
+int32 UBodycamInteractionCommandlet::RunScale(int32 Count, int32 Frames)
+{
+	using namespace BodycamInteractionTest;
+
+	int32 Failures = 0;
+	UWorld* World = UBodycamBenchmarkCommandlet::CreateBenchmarkWorld(TEXT("BodycamInteractionScale"));
+	if (!World)
+	{
+		UE_LOG(LogBodycam, Error, TEXT("FAILED: could not create the test world"));
+		return 1;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	ABodycamCharacter* Pawn = World->SpawnActor<ABodycamCharacter>(ABodycamCharacter::StaticClass(), FVector(0.f, 0.f, 100.f), FRotator::ZeroRotator, SpawnParams);
+	UBodycamInteractionComponent* Interaction = Pawn ? Pawn->GetInteraction() : nullptr;
+	UBodycamInteractionSubsystem* Subsystem = World->GetSubsystem<UBodycamInteractionSubsystem>();
+	if (!Interaction || !Subsystem)
+	{
+		UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+		UE_LOG(LogBodycam, Error, TEXT("FAILED: could not spawn the test pawn"));
+		return 1;
+	}
+	Interaction->SetComponentTickEnabled(false);
+
+	FRandomStream Random(Seed);
+	const int32 Side = FMath::CeilToInt(FMath::Sqrt((float)Count));
+	TArray<UBodycamInteractableComponent*> All;
+	All.Reserve(Count);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FVector Loc((i % Side) * GridSpacing, (i / Side) * GridSpacing, Random.FRandRange(60.f, 200.f));
+		All.Add(SpawnInteractable(World, Loc, Random.FRandRange(5.f, 40.f)));
+	}
+	BODYCAM_CHECK(Subsystem->GetNumInteractables() == Count, "every interactable registered");
+
+	// walk diagonally across the grid, looking around
+	const FBodycamFocusSelector Selector = FBodycamFocusSelector::FromConsole();
+	const float Extent = (Side - 1) * GridSpacing;
+	TArray<FBodycamFocusCandidate> Candidates;
+	TArray<double> UpdateMs;
+	int32 Mismatches = 0;
+	int32 Updates = 0;
+	int32 NumCandidates = 0;
+	const uint32 TracesBefore = Interaction->GetNumTraces();
+	for (int32 Frame = 0; Frame < Frames; ++Frame)
+	{
+		const float Alpha = (float)Frame / Frames;
+		const FVector ViewLoc(Extent * Alpha, Extent * Alpha, 130.f);
+		const FVector ViewDir = FRotator(10.f * FMath::Sin(Frame * 0.05f), 45.f + 120.f * FMath::Sin(Frame * 0.013f), 0.f).Vector();
+
+		if (Frame % FramesPerUpdate == 0)
+		{
+			const double Start = FPlatformTime::Seconds();
+			Interaction->UpdateFocus(ViewLoc, ViewDir, World->GetTimeSeconds());
+			UpdateMs.Add((FPlatformTime::Seconds() - Start) * 1000.0);
+			++Updates;
+
+			// the spatial index must find the same best target as scoring all of them
+			Subsystem->FindCandidates(Selector, ViewLoc, ViewDir, Candidates);
+			NumCandidates += Candidates.Num();
+			const UBodycamInteractableComponent* BruteBest = nullptr;
+			float BruteScore = -1.f;
+			for (const UBodycamInteractableComponent* C : All)
+			{
+				const float Score = Selector.Score(ViewLoc, ViewDir, C->GetComponentLocation(), C->GetFocusRadius());
+				if (Score > BruteScore)
+				{
+					BruteScore = Score;
+					BruteBest = C;
+				}
+			}
+			const UBodycamInteractableComponent* IndexBest = Candidates.Num() > 0 ? Candidates[0].Interactable.Get() : nullptr;
+			if ((BruteScore >= 0.f ? BruteBest : nullptr) != IndexBest && !(IndexBest && FMath::IsNearlyEqual(Candidates[0].Score, BruteScore)))
+			{
+				++Mismatches;
+			}
+		}
+
+		World->Tick(LEVELTICK_All, Dt);
+		++GFrameCounter;
+	}
+	const uint32 Traces = Interaction->GetNumTraces() - TracesBefore;
+
+	UpdateMs.Sort();
+	double SumMs = 0.0;
+	for (double Ms : UpdateMs)
+	{
+		SumMs += Ms;
+	}
+	UE_LOG(LogBodycam, Display, TEXT("  %d interactables, %d updates: avg %.4f ms, p99 %.4f ms, max %.4f ms, %.1f candidates and %.2f traces per update"),
+		Count, Updates, SumMs / FMath::Max(1, Updates), UpdateMs.Num() ? UpdateMs[FMath::Min(UpdateMs.Num() - 1, UpdateMs.Num() * 99 / 100)] : 0.0,
+		UpdateMs.Num() ? UpdateMs.Last() : 0.0, (float)NumCandidates / FMath::Max(1, Updates), (float)Traces / FMath::Max(1, Updates));
+
+	BODYCAM_CHECK(Mismatches == 0, "the spatial index agrees with scoring every interactable");
+	BODYCAM_CHECK(Traces <= (uint32)Updates, "at most one trace per focus update");
+
+	UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+	return Failures;
+}
+
+UBodycamInteractableComponent* UBodycamInteractionCommandlet::SpawnInteractable(UWorld* World, const FVector& Location, float Radius)
+{
+	AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location));
+	UBodycamInteractableComponent* Interactable = NewObject<UBodycamInteractableComponent>(Actor);
+	Interactable->SetFocusRadius(Radius);
+	Actor->SetRootComponent(Interactable);
+	Interactable->SetWorldLocation(Location);
+
+	// registering on an actor that has begun play begins play here, which registers the interactable
+	Interactable->RegisterComponent();
+	return Interactable;
+}
+
+void UBodycamInteractionCommandlet::OnInteracted(APawn* /*Instigator*/)
+{
+	++NumInteracts;
+}
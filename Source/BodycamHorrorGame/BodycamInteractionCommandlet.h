@@ -0,0 +1,46 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BodycamInteractionCommandlet.generated.h"
+
+class APawn;
+class UBodycamInteractableComponent;
+
+/**
+ * Headless checks for interaction focus selection.
+ *
+ *   UnrealEditor-Cmd BodycamHorrorGame -run=BodycamInteraction -nullrhi -unattended
+ *       [-Count=5000] [-Frames=600]
+ *
+ * Scoring: FBodycamFocusSelector cases (centred beats off-axis, near beats far, out of range /
+ * cone / behind rejected, refresh thresholds). World: a possessed pawn in front of interactables
+ * and a wall, stepped at 60 Hz: the visible one gets the focus over a better-scored occluded
+ * one, a held view issues no more traces than the cache age allows, and Interact uses the
+ * focus. Scale: -Count interactables on a grid while the view sweeps across it for -Frames,
+ * reporting focus update time and traces per update. Returns non-zero when a check fails.
+ */
+UCLASS()
+class UBodycamInteractionCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBodycamInteractionCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	int32 RunScoring();
+	int32 RunWorld();
+	int32 RunScale(int32 Count, int32 Frames);
+
+	static UBodycamInteractableComponent* SpawnInteractable(UWorld* World, const FVector& Location, float Radius);
+
+	UFUNCTION()
+	void OnInteracted(APawn* Instigator);
+
+	int32 NumInteracts = 0;
+};
@@ -0,0 +1,239 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamInteractionComponent.h"
+#include "BodycamHorrorGame.h"
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+
+static float GBodycamInteractRate = 15.f;
+static FAutoConsoleVariableRef CVarBodycamInteractRate(
+	TEXT("bodycam.Interact.Rate"),
+	GBodycamInteractRate,
+	TEXT("Focus updates per second for the local player (0 = every frame)."));
+
+namespace BodycamInteraction
+{
+	static constexpr float ReachSlack = 1.5f; // server accepts this much past the focus distance (lag, cached focus)
+}
+
+UBodycamInteractionComponent::UBodycamInteractionComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = true;
+
+	// only for the Server RPC; nothing on it replicates
+	SetIsReplicatedByDefault(true);
+}
+
+void UBodycamInteractionComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	TraceDelegate.BindUObject(this, &UBodycamInteractionComponent::OnTraceDone);
+	RefreshTickEnabled();
+}
+
+bool UBodycamInteractionComponent::IsLocalPlayerPawn() const
+{
+	const APawn* Pawn = Cast<APawn>(GetOwner());
+	const AController* Controller = Pawn ? Pawn->GetController() : nullptr;
+	return Controller && Controller->IsLocalPlayerController();
+}
+
+void UBodycamInteractionComponent::RefreshTickEnabled()
+{
+	// AI and remote pawns never have a focus; they do not tick at all
+	const bool bLocalPlayer = IsLocalPlayerPawn();
+	if (!bLocalPlayer)
+	{
+		SetFocus(nullptr);
+	}
+	SetComponentTickEnabled(bLocalPlayer);
+}
+
+void UBodycamInteractionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	TraceDelegate.Unbind();
+	SetFocus(nullptr);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UBodycamInteractionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	const float Interval = GBodycamInteractRate > 0.f ? 1.f / GBodycamInteractRate : 0.f;
+	if (GetComponentTickInterval() != Interval)
+	{
+		SetComponentTickInterval(Interval);
+	}
+
+	// only the local player looking through this pawn has a focus
+	if (!IsLocalPlayerPawn())
+	{
+		SetFocus(nullptr);
+		return;
+	}
+
+	FVector ViewLoc;
+	FRotator ViewRot;
+	Cast<APawn>(GetOwner())->GetController()->GetPlayerViewPoint(ViewLoc, ViewRot);
+	UpdateFocus(ViewLoc, ViewRot.Vector(), GetWorld()->GetTimeSeconds());
+}
+
+void UBodycamInteractionComponent::UpdateFocus(const FVector& ViewLoc, const FVector& ViewDir, double NowSeconds)
+{
+	BODYCAM_SCOPE(STAT_BodycamInteraction, BodycamInteraction);
+
+	UBodycamInteractionSubsystem* Interaction = GetWorld()->GetSubsystem<UBodycamInteractionSubsystem>();
+	if (!Interaction)
+	{
+		return;
+	}
+
+	// a trace in flight finishes first, then the view gets another look
+	if (PendingTrace.IsValid())
+	{
+		return;
+	}
+
+	const FBodycamFocusSelector Selector = FBodycamFocusSelector::FromConsole();
+	const bool bResolve = !bHasCachedView
+		|| CachedVersion != Interaction->GetVersion()
+		|| NowSeconds - CachedSeconds > Selector.MaxCacheSeconds
+		|| Selector.HasViewMoved(CachedViewLoc, CachedViewDir, ViewLoc, ViewDir);
+
+	if (bResolve)
+	{
+		Interaction->FindCandidates(Selector, ViewLoc, ViewDir, Candidates);
+		NextCandidate = 0;
+		CachedViewLoc = ViewLoc;
+		CachedViewDir = ViewDir;
+		CachedVersion = Interaction->GetVersion();
+		CachedSeconds = NowSeconds;
+		bHasCachedView = true;
+
+		// out of range / cone: no trace needed to drop it
+		UBodycamInteractableComponent* Current = Focus.Get();
+		if (Current && !Candidates.ContainsByPredicate([Current](const FBodycamFocusCandidate& C) { return C.Interactable == Current; }))
+		{
+			SetFocus(nullptr);
+		}
+	}
+
+	IssueTrace(ViewLoc);
+}
+
+void UBodycamInteractionComponent::IssueTrace(const FVector& ViewLoc)
+{
+	// skip candidates that went away since the resolve
+	while (Candidates.IsValidIndex(NextCandidate) && !Candidates[NextCandidate].Interactable.IsValid())
+	{
+		++NextCandidate;
+	}
+	if (!Candidates.IsValidIndex(NextCandidate))
+	{
+		// nothing left to check: none of them is visible
+		if (NextCandidate > 0 && NextCandidate == Candidates.Num())
+		{
+			SetFocus(nullptr);
+		}
+		return;
+	}
+
+	const FBodycamFocusCandidate& Candidate = Candidates[NextCandidate];
+	UBodycamInteractableComponent* Target = Candidate.Interactable.Get();
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(BodycamInteraction), false, GetOwner());
+	Params.AddIgnoredActor(Target->GetOwner());
+
+	PendingTarget = Target;
+	PendingTrace = GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, ViewLoc, Candidate.Location, ECC_Visibility, Params,
+		FCollisionResponseParams::DefaultResponseParam, &TraceDelegate);
+	++NumTraces;
+	INC_DWORD_STAT(STAT_BodycamInteractTraces);
+}
+
+void UBodycamInteractionComponent::OnTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	if (Handle != PendingTrace)
+	{
+		return;
+	}
+	PendingTrace = FTraceHandle();
+
+	UBodycamInteractableComponent* Target = PendingTarget.Get();
+	PendingTarget.Reset();
+	if (!Target)
+	{
+		++NextCandidate;
+		return;
+	}
+
+	if (FHitResult::GetFirstBlockingHit(Datum.OutHits) == nullptr)
+	{
+		// best visible one: done until the view moves
+		SetFocus(Target);
+		NextCandidate = Candidates.Num() + 1;
+		return;
+	}
+
+	// blocked: drop it if it was the focus and try the next one on the next update
+	if (Focus == Target)
+	{
+		SetFocus(nullptr);
+	}
+	++NextCandidate;
+}
+
+void UBodycamInteractionComponent::SetFocus(UBodycamInteractableComponent* NewFocus)
+{
+	if (Focus.Get() == NewFocus)
+	{
+		return;
+	}
+	Focus = NewFocus;
+	OnFocusChanged.Broadcast(NewFocus);
+}
+
+bool UBodycamInteractionComponent::Interact()
+{
+	UBodycamInteractableComponent* Target = Focus.Get();
+	if (!Target || !Target->IsInteractionEnabled())
+	{
+		return false;
+	}
+
+	if (GetOwner()->HasAuthority())
+	{
+		Target->Interact(Cast<APawn>(GetOwner()));
+	}
+	else
+	{
+		ServerInteract(Target);
+	}
+	return true;
+}
+
+void UBodycamInteractionComponent::ServerInteract_Implementation(UBodycamInteractableComponent* Target)
+{
+	if (Target && CanReach(Target))
+	{
+		Target->Interact(Cast<APawn>(GetOwner()));
+	}
+}
+
+bool UBodycamInteractionComponent::CanReach(const UBodycamInteractableComponent* Target) const
+{
+	const APawn* Pawn = Cast<APawn>(GetOwner());
+	if (!Pawn)
+	{
+		return false;
+	}
+	const float Reach = FBodycamFocusSelector::FromConsole().MaxDistance * BodycamInteraction::ReachSlack + Target->GetFocusRadius();
+	return FVector::DistSquared(Pawn->GetPawnViewLocation(), Target->GetComponentLocation()) <= FMath::Square(Reach);
+}
@@ -0,0 +1,86 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WorldCollision.h"
+#include "BodycamInteraction.h"
+#include "BodycamInteractionComponent.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FBodycamFocusChangedSignature, UBodycamInteractableComponent*, NewFocus);
+
+/**
+ * What the local player is looking at, and IA_Interact on it. Focus is resolved at
+ * bodycam.Interact.Rate, not every frame: the interaction subsystem hands back the few
+ * interactables in range and in the view cone, best first, and only the best one still
+ * unchecked gets a visibility trace (one async trace per update, result the next frame). The
+ * result is cached until the view moves meaningfully, so a still player costs no traces.
+ *
+ * Interact() uses the cached focus; clients send it to the server, which checks the distance
+ * again before calling the interactable.
+ */
+UCLASS(ClassGroup=(Bodycam), meta=(BlueprintSpawnableComponent))
+class BODYCAMHORRORGAME_API UBodycamInteractionComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UBodycamInteractionComponent();
+
+	/** Uses the focused interactable; false when nothing is focused. */
+	UFUNCTION(BlueprintCallable, Category="Bodycam|Interaction")
+	bool Interact();
+
+	UFUNCTION(BlueprintPure, Category="Bodycam|Interaction")
+	UBodycamInteractableComponent* GetFocus() const { return Focus.Get(); }
+
+	/** Prompt UI hooks here; fires on the owning client only. */
+	UPROPERTY(BlueprintAssignable, Category="Bodycam|Interaction")
+	FBodycamFocusChangedSignature OnFocusChanged;
+
+	/** One focus update from this view (the tick does this with the controller's view; headless drivers call it directly). */
+	void UpdateFocus(const FVector& ViewLoc, const FVector& ViewDir, double NowSeconds);
+
+	/** Ticks only while a local player controls the owner; the owner calls this when its controller changes. */
+	void RefreshTickEnabled();
+
+	/** Visibility traces issued so far. */
+	uint32 GetNumTraces() const { return NumTraces; }
+
+	// UActorComponent
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+	UFUNCTION(Server, Reliable)
+	void ServerInteract(UBodycamInteractableComponent* Target);
+
+	// server side: still in reach of the pawn?
+	bool CanReach(const UBodycamInteractableComponent* Target) const;
+
+	bool IsLocalPlayerPawn() const;
+	void SetFocus(UBodycamInteractableComponent* NewFocus);
+	void IssueTrace(const FVector& ViewLoc);
+	void OnTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	TWeakObjectPtr<UBodycamInteractableComponent> Focus;
+
+	// ranked at the last resolve; NextCandidate is the next one to trace (past the end = done)
+	TArray<FBodycamFocusCandidate> Candidates;
+	int32 NextCandidate = 0;
+
+	FTraceHandle PendingTrace;
+	TWeakObjectPtr<UBodycamInteractableComponent> PendingTarget;
+	FTraceDelegate TraceDelegate;
+
+	// view and interactables at the last resolve
+	FVector CachedViewLoc = FVector::ZeroVector;
+	FVector CachedViewDir = FVector::ForwardVector;
+	uint32 CachedVersion = 0;
+	double CachedSeconds = 0.0;
+	bool bHasCachedView = false;
+
+	uint32 NumTraces = 0;
+};
@@ -0,0 +1,260 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamLatency.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamCharacter.h"
+#include "BodycamMotionSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+static bool GBodycamLatencyTrack = false;
+static FAutoConsoleVariableRef CVarBodycamLatencyTrack(
+	TEXT("bodycam.Latency.Track"),
+	GBodycamLatencyTrack,
+	TEXT("Time look input of locally controlled bodycam pawns through free-aim, controller, flashlight and view (bodycam.Latency.Report)."));
+
+static float GBodycamLatencySettleDeg = 0.1f;
+static FAutoConsoleVariableRef CVarBodycamLatencySettleDeg(
+	TEXT("bodycam.Latency.SettleDeg"),
+	GBodycamLatencySettleDeg,
+	TEXT("The flashlight counts as settled (and the free-aim as recentered) within this many degrees."));
+
+namespace BodycamLatency
+{
+	static void Report(UWorld* World, bool bReset)
+	{
+		const UBodycamMotionSubsystem* Motion = World ? World->GetSubsystem<UBodycamMotionSubsystem>() : nullptr;
+		if (!Motion)
+		{
+			return;
+		}
+
+		FString Summary = FBodycamLatencyTracker::GetSummaryCsvHeader();
+		FString Histogram = FBodycamLatencyTracker::GetHistogramCsvHeader();
+		int32 NumTracked = 0;
+		for (ABodycamCharacter* Pawn : Motion->GetPawns())
+		{
+			if (FBodycamLatencyTracker* Tracker = Pawn ? Pawn->GetLatencyTracker() : nullptr)
+			{
+				Tracker->LogSummary(Pawn->GetName());
+				Tracker->AppendCsv(Pawn->GetName(), Summary, Histogram);
+				if (bReset)
+				{
+					Tracker->Reset();
+				}
+				++NumTracked;
+			}
+		}
+
+		if (NumTracked == 0)
+		{
+			UE_LOG(LogBodycam, Display, TEXT("No bodycam latency samples (bodycam.Latency.Track 1, then look around)"));
+			return;
+		}
+
+		const FString Base = FPaths::ProjectSavedDir() / TEXT("Profiling/Bodycam") / FString::Printf(TEXT("BodycamLatency-%s"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")));
+		FFileHelper::SaveStringToFile(Summary, *(Base + TEXT(".csv")));
+		FFileHelper::SaveStringToFile(Histogram, *(Base + TEXT("-Histogram.csv")));
+		UE_LOG(LogBodycam, Display, TEXT("Latency report written to %s.csv"), *Base);
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CmdBodycamLatencyReport(
+	TEXT("bodycam.Latency.Report"),
+	TEXT("Log look latency per stage and settle times of the tracked pawns and write them to Saved/Profiling/Bodycam. Args: [Reset=0]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		BodycamLatency::Report(World, Args.Num() > 0 && FCString::Atoi(*Args[0]) != 0);
+	}));
+
+// ---------------------------------------------------------------------------------------------
+
+void FBodycamLatencyHistogram::Add(double Ms)
+{
+	const int32 Bucket = Ms <= MinMs ? 0
+		: FMath::Min(NumBuckets - 1, FMath::CeilToInt32(BucketsPerOctave * FMath::Log2(Ms / MinMs)));
+	++Buckets[Bucket];
+	++Count;
+	SumMs += Ms;
+	MaxMs = FMath::Max(MaxMs, Ms);
+}
+
+double FBodycamLatencyHistogram::GetBucketUpperMs(int32 Bucket)
+{
+	return MinMs * FMath::Pow(2.0, (double)Bucket / BucketsPerOctave);
+}
+
+double FBodycamLatencyHistogram::GetPercentile(double P) const
+{
+	if (Count == 0)
+	{
+		return 0.0;
+	}
+	const uint32 Rank = (uint32)FMath::Clamp<double>(FMath::CeilToDouble(P * Count), 1.0, Count);
+	uint32 Seen = 0;
+	for (int32 Bucket = 0; Bucket < NumBuckets - 1; ++Bucket)
+	{
+		Seen += Buckets[Bucket];
+		if (Seen >= Rank)
+		{
+			return FMath::Min(GetBucketUpperMs(Bucket), MaxMs);
+		}
+	}
+	return MaxMs; // open ended last bucket
+}
+
+// ---------------------------------------------------------------------------------------------
+
+bool FBodycamLatencyTracker::IsEnabled()
+{
+	return GBodycamLatencyTrack;
+}
+
+void FBodycamLatencyTracker::BeginSample(double FirstEventSeconds, double Now)
+{
+	// a sample that never reached the view (no camera modifier) just ends here
+	bSampleOpen = true;
+	StampedStages = 0;
+	SampleInputSeconds = FirstEventSeconds;
+	bInputThisStep = true;
+	Stamp(EBodycamLatencyStage::Resolve, Now);
+}
+
+void FBodycamLatencyTracker::Stamp(EBodycamLatencyStage Stage, double Now)
+{
+	const uint8 Bit = 1 << (int32)Stage;
+	if (!bSampleOpen || (StampedStages & Bit))
+	{
+		return;
+	}
+	StampedStages |= Bit;
+
+	const double Ms = (Now - SampleInputSeconds) * 1000.0;
+	Stages[(int32)Stage].Add(Ms);
+
+	switch (Stage)
+	{
+	case EBodycamLatencyStage::Resolve:
+		TRACE_COUNTER_SET(BodycamLookToResolveMs, Ms);
+		break;
+	case EBodycamLatencyStage::Controller:
+		TRACE_COUNTER_SET(BodycamLookToControllerMs, Ms);
+		SET_FLOAT_STAT(STAT_BodycamLookToControllerMs, Ms);
+		break;
+	case EBodycamLatencyStage::Flashlight:
+		TRACE_COUNTER_SET(BodycamLookToFlashlightMs, Ms);
+		SET_FLOAT_STAT(STAT_BodycamLookToFlashlightMs, Ms);
+		break;
+	default:
+		TRACE_COUNTER_SET(BodycamLookToViewMs, Ms);
+		SET_FLOAT_STAT(STAT_BodycamLookToViewMs, Ms);
+		bSampleOpen = false;
+		break;
+	}
+}
+
+void FBodycamLatencyTracker::UpdateConvergence(float LightErrorDeg, float AimOffsetDeg, float StepSeconds)
+{
+	// new input restarts both clocks; they only run out once the input stops
+	if (bInputThisStep)
+	{
+		bInputThisStep = false;
+		SettleSeconds = 0.f;
+		RecenterSeconds = 0.f;
+		return;
+	}
+
+	if (SettleSeconds >= 0.f)
+	{
+		SettleSeconds += StepSeconds;
+		if (LightErrorDeg <= GBodycamLatencySettleDeg)
+		{
+			LightSettle.Add(SettleSeconds * 1000.0);
+			TRACE_COUNTER_SET(BodycamLightSettleMs, SettleSeconds * 1000.0);
+			SET_FLOAT_STAT(STAT_BodycamLightSettleMs, SettleSeconds * 1000.0);
+			SettleSeconds = -1.f;
+		}
+	}
+	if (RecenterSeconds >= 0.f)
+	{
+		RecenterSeconds += StepSeconds;
+		if (AimOffsetDeg <= GBodycamLatencySettleDeg)
+		{
+			AimRecenter.Add(RecenterSeconds * 1000.0);
+			TRACE_COUNTER_SET(BodycamAimRecenterMs, RecenterSeconds * 1000.0);
+			RecenterSeconds = -1.f;
+		}
+	}
+}
+
+void FBodycamLatencyTracker::Reset()
+{
+	*this = FBodycamLatencyTracker();
+}
+
+const TCHAR* FBodycamLatencyTracker::GetStageName(EBodycamLatencyStage Stage)
+{
+	switch (Stage)
+	{
+	case EBodycamLatencyStage::Resolve:    return TEXT("look_to_resolve");
+	case EBodycamLatencyStage::Controller: return TEXT("look_to_controller");
+	case EBodycamLatencyStage::Flashlight: return TEXT("look_to_flashlight");
+	case EBodycamLatencyStage::View:       return TEXT("look_to_view");
+	default:                               return TEXT("?");
+	}
+}
+
+const TCHAR* FBodycamLatencyTracker::GetSummaryCsvHeader()
+{
+	return TEXT("label,metric,count,mean_ms,p50_ms,p90_ms,p99_ms,max_ms\n");
+}
+
+const TCHAR* FBodycamLatencyTracker::GetHistogramCsvHeader()
+{
+	return TEXT("label,metric,bucket_upper_ms,count\n");
+}
+
+void FBodycamLatencyTracker::AppendCsv(const FString& Label, FString& SummaryCsv, FString& HistogramCsv) const
+{
+	auto Append = [&Label, &SummaryCsv, &HistogramCsv](const TCHAR* Metric, const FBodycamLatencyHistogram& H)
+	{
+		SummaryCsv += FString::Printf(TEXT("%s,%s,%u,%.3f,%.3f,%.3f,%.3f,%.3f\n"), *Label, Metric, H.GetCount(),
+			H.GetMean(), H.GetPercentile(0.5), H.GetPercentile(0.9), H.GetPercentile(0.99), H.GetMax());
+
+		// empty buckets are left out
+		for (int32 Bucket = 0; Bucket < FBodycamLatencyHistogram::NumBuckets; ++Bucket)
+		{
+			if (H.GetBucketCount(Bucket) > 0)
+			{
+				HistogramCsv += FString::Printf(TEXT("%s,%s,%.3f,%u\n"), *Label, Metric,
+					FBodycamLatencyHistogram::GetBucketUpperMs(Bucket), H.GetBucketCount(Bucket));
+			}
+		}
+	};
+
+	for (int32 Stage = 0; Stage < (int32)EBodycamLatencyStage::Num; ++Stage)
+	{
+		Append(GetStageName((EBodycamLatencyStage)Stage), Stages[Stage]);
+	}
+	Append(TEXT("light_settle"), LightSettle);
+	Append(TEXT("aim_recenter"), AimRecenter);
+}
+
+void FBodycamLatencyTracker::LogSummary(const FString& Label) const
+{
+	auto Line = [](const FBodycamLatencyHistogram& H)
+	{
+		return FString::Printf(TEXT("p50 %.2f p90 %.2f p99 %.2f max %.2f ms (%u)"), H.GetPercentile(0.5), H.GetPercentile(0.9), H.GetPercentile(0.99), H.GetMax(), H.GetCount());
+	};
+
+	UE_LOG(LogBodycam, Display, TEXT("%s look latency:"), *Label);
+	for (int32 Stage = 0; Stage < (int32)EBodycamLatencyStage::Num; ++Stage)
+	{
+		UE_LOG(LogBodycam, Display, TEXT("  %-20s %s"), GetStageName((EBodycamLatencyStage)Stage), *Line(Stages[Stage]));
+	}
+	UE_LOG(LogBodycam, Display, TEXT("  %-20s %s"), TEXT("light_settle"), *Line(LightSettle));
+	UE_LOG(LogBodycam, Display, TEXT("  %-20s %s"), TEXT("aim_recenter"), *Line(AimRecenter));
+}
@@ -0,0 +1,97 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Where a look event has got to on its way to the screen. */
+enum class EBodycamLatencyStage : uint8
+{
+	Resolve,     // free-aim split (UBodycamMotionSubsystem::Gather)
+	Controller,  // control rotation turned (ABodycamCharacter::LatchViewRotation)
+	Flashlight,  // flashlight rotation written (camera modifier, or Apply for pawns without one)
+	View,        // final view built (camera modifier)
+	Num
+};
+
+/** Log-spaced histogram of milliseconds: four buckets per octave from 0.1 ms, the last one open ended. */
+struct BODYCAMHORRORGAME_API FBodycamLatencyHistogram
+{
+	static constexpr int32 NumBuckets = 56;
+	static constexpr int32 BucketsPerOctave = 4;
+	static constexpr double MinMs = 0.1;
+
+	void Add(double Ms);
+	void Reset() { *this = FBodycamLatencyHistogram(); }
+
+	uint32 GetCount() const { return Count; }
+	double GetMean() const { return Count > 0 ? SumMs / Count : 0.0; }
+	double GetMax() const { return MaxMs; }
+
+	/** Upper edge of the bucket holding the P-th sample (never above the max seen). */
+	double GetPercentile(double P) const;
+
+	uint32 GetBucketCount(int32 Bucket) const { return Buckets[Bucket]; }
+	static double GetBucketUpperMs(int32 Bucket);
+
+private:
+	uint32 Buckets[NumBuckets] = {};
+	uint32 Count = 0;
+	double SumMs = 0.0;
+	double MaxMs = 0.0;
+};
+
+/**
+ * Follows the look input of one locally controlled pawn through the frame: each resolve of
+ * buffered look events opens a sample, every stage it reaches records (now - oldest event) once,
+ * and the final view closes it. Also times how long the interpolation takes to settle after the
+ * last input, in simulated seconds:
+ *
+ *   light settle: the flashlight reaching its aim target (FlashAimSmoothing)
+ *   aim recenter: the free-aim offset returning to the camera (FlashAimReturnSpeed)
+ *
+ * Only exists while bodycam.Latency.Track is on. Event times are when Enhanced Input delivered
+ * the event, so the OS and device part of the latency is not in here.
+ */
+struct BODYCAMHORRORGAME_API FBodycamLatencyTracker
+{
+	static bool IsEnabled();
+
+	/** Buffered look events were resolved; FirstEventSeconds is the oldest (FPlatformTime::Seconds()). */
+	void BeginSample(double FirstEventSeconds, double Now);
+
+	/** First time the open sample reaches Stage; View closes it. */
+	void Stamp(EBodycamLatencyStage Stage, double Now);
+
+	/** Once per step after the flashlight solve: light-to-target error and free-aim offset (deg). */
+	void UpdateConvergence(float LightErrorDeg, float AimOffsetDeg, float StepSeconds);
+
+	void Reset();
+
+	const FBodycamLatencyHistogram& GetStage(EBodycamLatencyStage Stage) const { return Stages[(int32)Stage]; }
+	const FBodycamLatencyHistogram& GetLightSettle() const { return LightSettle; }
+	const FBodycamLatencyHistogram& GetAimRecenter() const { return AimRecenter; }
+
+	/** Summary rows ("label,metric,count,mean_ms,p50_ms,p90_ms,p99_ms,max_ms") and the histograms, long form. */
+	static const TCHAR* GetSummaryCsvHeader();
+	static const TCHAR* GetHistogramCsvHeader();
+	void AppendCsv(const FString& Label, FString& SummaryCsv, FString& HistogramCsv) const;
+
+	void LogSummary(const FString& Label) const;
+
+	static const TCHAR* GetStageName(EBodycamLatencyStage Stage);
+
+private:
+	FBodycamLatencyHistogram Stages[(int32)EBodycamLatencyStage::Num];
+	FBodycamLatencyHistogram LightSettle;
+	FBodycamLatencyHistogram AimRecenter;
+
+	double SampleInputSeconds = 0.0;
+	uint8 StampedStages = 0;
+	bool bSampleOpen = false;
+	bool bInputThisStep = false;
+
+	// simulated time since the last input while still settling (< 0 = settled / nothing to time)
+	float SettleSeconds = -1.f;
+	float RecenterSeconds = -1.f;
+};
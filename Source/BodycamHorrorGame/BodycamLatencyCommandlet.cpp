@@ -0,0 +1,196 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamLatencyCommandlet.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamBenchmarkCommandlet.h"
+#include "BodycamCameraModifier.h"
+#include "BodycamCharacter.h"
+#include "BodycamLatency.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/IConsoleManager.h"
+
+namespace BodycamLatencyPatterns
+{
+	static constexpr float FlickDeg = 30.f;
+	static constexpr float FlickSeconds = 0.08f;
+	static constexpr float SweepDeg = 20.f;
+	static constexpr float SweepHz = 0.5f;
+	static constexpr float JitterRate = 30.f; // units/s, per event
+	static constexpr int32 Seed = 1337;
+}
+
+UBodycamLatencyCommandlet::UBodycamLatencyCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UBodycamLatencyCommandlet::Main(const FString& Params)
+{
+	FString PatternsStr = TEXT("flick,sweep,jitter");
+	FParse::Value(*Params, TEXT("Patterns="), PatternsStr, false);
+	TArray<FString> Patterns;
+	PatternsStr.ParseIntoArray(Patterns, TEXT(","));
+
+	float Seconds = 10.f;
+	float FrameRate = 60.f;
+	float PollRate = 1000.f;
+	FParse::Value(*Params, TEXT("Seconds="), Seconds);
+	FParse::Value(*Params, TEXT("FrameRate="), FrameRate);
+	FParse::Value(*Params, TEXT("PollRate="), PollRate);
+	FrameRate = FMath::Max(1.f, FrameRate);
+	PollRate = FMath::Max(FrameRate, PollRate);
+
+	// Name=Value pairs, same names as the profile's tuning properties
+	FString TuneStr;
+	TArray<FBodycamTuningOverride> Tune;
+	if (FParse::Value(*Params, TEXT("Tune="), TuneStr, false))
+	{
+		TArray<FString> Pairs;
+		TuneStr.ParseIntoArray(Pairs, TEXT(","));
+		for (const FString& Pair : Pairs)
+		{
+			FString Name, Value;
+			if (Pair.Split(TEXT("="), &Name, &Value))
+			{
+				FBodycamTuningOverride& Override = Tune.AddDefaulted_GetRef();
+				Override.Property = FName(*Name);
+				Override.Value = FCString::Atof(*Value);
+			}
+		}
+	}
+
+	FString OutDir = FPaths::ProjectSavedDir() / TEXT("Profiling/Bodycam");
+	FParse::Value(*Params, TEXT("Out="), OutDir);
+
+	IConsoleVariable* TrackVar = IConsoleManager::Get().FindConsoleVariable(TEXT("bodycam.Latency.Track"));
+	if (TrackVar)
+	{
+		TrackVar->Set(1);
+	}
+
+	FString Summary = FBodycamLatencyTracker::GetSummaryCsvHeader();
+	FString Histogram = FBodycamLatencyTracker::GetHistogramCsvHeader();
+	for (const FString& Pattern : Patterns)
+	{
+		// the tuning goes in the label so runs with different values can share a sheet
+		const FString Label = TuneStr.IsEmpty() ? Pattern : FString::Printf(TEXT("%s %s"), *Pattern, *TuneStr.Replace(TEXT(","), TEXT(";")));
+		if (!RunPattern(Pattern, Tune, Seconds, FrameRate, PollRate, Label, Summary, Histogram))
+		{
+			UE_LOG(LogBodycam, Error, TEXT("Could not run look pattern '%s'"), *Pattern);
+			return 1;
+		}
+	}
+
+	if (TrackVar)
+	{
+		TrackVar->Set(0);
+	}
+
+	const FString Base = OutDir / FString::Printf(TEXT("BodycamLatency-%s"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")));
+	FFileHelper::SaveStringToFile(Summary, *(Base + TEXT(".csv")));
+	FFileHelper::SaveStringToFile(Histogram, *(Base + TEXT("-Histogram.csv")));
+	UE_LOG(LogBodycam, Display, TEXT("Latency results written to %s.csv"), *Base);
+	return 0;
+}
+
+bool UBodycamLatencyCommandlet::RunPattern(const FString& Pattern, const TArray<FBodycamTuningOverride>& Tune, float Seconds, float FrameRate, float PollRate,
+	const FString& Label, FString& SummaryCsv, FString& HistogramCsv)
+{
+	if (Pattern != TEXT("flick") && Pattern != TEXT("sweep") && Pattern != TEXT("jitter"))
+	{
+		return false;
+	}
+
+	UWorld* World = UBodycamBenchmarkCommandlet::CreateBenchmarkWorld(TEXT("BodycamLatency"));
+	if (!World)
+	{
+		return false;
+	}
+
+	// a local player controller makes the pawn locally controlled and its camera manager runs the modifier
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	const FVector Start(0.f, 0.f, 100.f);
+	APlayerController* PC = World->SpawnActor<APlayerController>(APlayerController::StaticClass(), Start, FRotator::ZeroRotator, SpawnParams);
+	ABodycamCharacter* Pawn = World->SpawnActor<ABodycamCharacter>(ABodycamCharacter::StaticClass(), Start, FRotator::ZeroRotator, SpawnParams);
+	if (!PC || !Pawn)
+	{
+		UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+		return false;
+	}
+	PC->Possess(Pawn);
+	UBodycamCameraModifier::AddTo(PC);
+	if (Tune.Num() > 0)
+	{
+		Pawn->SetTuningOverrides(Tune);
+	}
+
+	const float Dt = 1.f / FrameRate;
+	const int32 Frames = FMath::CeilToInt(Seconds * FrameRate);
+	const int32 EventsPerFrame = FMath::Max(1, FMath::RoundToInt(PollRate / FrameRate));
+	FRandomStream Random(BodycamLatencyPatterns::Seed);
+
+	double PrevFrameStart = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < Frames; ++Frame)
+	{
+		const double FrameStart = FPlatformTime::Seconds();
+
+		// what the mouse sent during the last frame, handed over as this frame's input
+		const double Span = FrameStart - PrevFrameStart;
+		for (int32 Event = 0; Event < EventsPerFrame; ++Event)
+		{
+			const float Alpha = (Event + 1.f) / EventsPerFrame;
+			const FVector2f Rate = GetLookRate(Pattern, (Frame - 1 + Alpha) * Dt, Random);
+			Pawn->AddLookInput(Rate * (Dt / EventsPerFrame), PrevFrameStart + Span * Alpha);
+		}
+		PrevFrameStart = FrameStart;
+
+		World->Tick(LEVELTICK_All, Dt);
+		StaticTick(Dt, true);
+		++GFrameCounter;
+
+		const double Remaining = Dt - (FPlatformTime::Seconds() - FrameStart);
+		if (Remaining > 0.0)
+		{
+			FPlatformProcess::Sleep((float)Remaining);
+		}
+	}
+
+	bool bOk = false;
+	if (const FBodycamLatencyTracker* Tracker = Pawn->GetLatencyTracker())
+	{
+		Tracker->LogSummary(Label);
+		Tracker->AppendCsv(Label, SummaryCsv, HistogramCsv);
+		bOk = Tracker->GetStage(EBodycamLatencyStage::Resolve).GetCount() > 0;
+	}
+
+	UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+	return bOk;
+}
+
+FVector2f UBodycamLatencyCommandlet::GetLookRate(const FString& Pattern, float Seconds, FRandomStream& Random)
+{
+	using namespace BodycamLatencyPatterns;
+
+	if (Pattern == TEXT("flick"))
+	{
+		const float T = FMath::Max(0.f, Seconds);
+		const float InSecond = FMath::Fractional(T);
+		const float Direction = (FMath::FloorToInt(T) & 1) ? -1.f : 1.f;
+		return InSecond < FlickSeconds ? FVector2f(Direction * FlickDeg / FlickSeconds, 0.f) : FVector2f::ZeroVector;
+	}
+	if (Pattern == TEXT("sweep"))
+	{
+		// derivative of SweepDeg * sin(2 pi f t)
+		const float W = 2.f * PI * SweepHz;
+		return FVector2f(SweepDeg * W * FMath::Cos(W * Seconds), 0.f);
+	}
+	return FVector2f(Random.FRandRange(-1.f, 1.f), Random.FRandRange(-1.f, 1.f)) * JitterRate;
+}
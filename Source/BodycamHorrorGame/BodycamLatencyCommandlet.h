@@ -0,0 +1,46 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BodycamLatencyCommandlet.generated.h"
+
+struct FBodycamTuningOverride;
+
+/**
+ * Headless look-latency measurement for the free-aim / flashlight path (FBodycamLatencyTracker).
+ *
+ *   UnrealEditor-Cmd BodycamHorrorGame -run=BodycamLatency -nullrhi -unattended
+ *       [-Patterns=flick,sweep,jitter] [-Seconds=10] [-FrameRate=60] [-PollRate=1000]
+ *       [-Tune=FlashAimSmoothing=12,FlashAimReturnSpeed=4] [-Out=<dir>]
+ *
+ * Possesses one bodycam pawn with a player controller (so the camera modifier builds the view)
+ * and feeds it synthetic mouse events at PollRate, time stamped as if they arrived spread over
+ * the previous frame, ticking in real time at FrameRate. Each pattern runs in a fresh world:
+ *
+ *   flick   30 deg in 80 ms every second, alternating direction, then hands off (settle times)
+ *   sweep   continuous 20 deg sine at 0.5 Hz
+ *   jitter  small random hand tremor on both axes
+ *
+ * -Tune applies tuning overrides to the pawn, so runs with different values can be compared.
+ * Writes the per-stage summary and histograms as CSV to Saved/Profiling/Bodycam; add
+ * -trace=default,counters for the per-sample Bodycam/Latency counters in Insights.
+ */
+UCLASS()
+class UBodycamLatencyCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBodycamLatencyCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	bool RunPattern(const FString& Pattern, const TArray<FBodycamTuningOverride>& Tune, float Seconds, float FrameRate, float PollRate,
+		const FString& Label, FString& SummaryCsv, FString& HistogramCsv);
+
+	/** Look input (deg-ish units per second) of Pattern at time Seconds. */
+	static FVector2f GetLookRate(const FString& Pattern, float Seconds, FRandomStream& Random);
+};
@@ -0,0 +1,139 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamLightBudgetCommandlet.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamCommandletTest.h"
+#include "BodycamFlashlightGovernor.h"
+
+namespace BodycamLightBudgetTest
+{
+	static constexpr float UnderMs = 10.f;
+	static constexpr float OverMs  = 25.f;
+	static constexpr float BandMs  = 15.5f; // between Target * RecoverRatio and Target with the defaults
+
+	static FBodycamLightBudget MakeBudget()
+	{
+		FBodycamLightBudget Budget;
+		Budget.MaxLevel = UBodycamFlashlightGovernor::NumSteps * UBodycamFlashlightGovernor::NumPriorityClasses;
+		return Budget;
+	}
+
+	/** Feeds Count samples; returns the largest level change of a single sample. */
+	static int32 Feed(FBodycamLightBudget& Budget, float FrameMs, int32 Count)
+	{
+		int32 MaxJump = 0;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const int32 Prev = Budget.GetLevel();
+			Budget.AddSample(FrameMs);
+			MaxJump = FMath::Max(MaxJump, FMath::Abs(Budget.GetLevel() - Prev));
+		}
+		return MaxJump;
+	}
+
+	/** Samples until the level differs from the current one (or Limit samples). */
+	static int32 FramesToChange(FBodycamLightBudget& Budget, float FrameMs, int32 Limit)
+	{
+		const int32 Start = Budget.GetLevel();
+		for (int32 i = 1; i <= Limit; ++i)
+		{
+			Budget.AddSample(FrameMs);
+			if (Budget.GetLevel() != Start)
+			{
+				return i;
+			}
+		}
+		return INDEX_NONE;
+	}
+}
+
+UBodycamLightBudgetCommandlet::UBodycamLightBudgetCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UBodycamLightBudgetCommandlet::Main(const FString& Params)
+{
+	using namespace BodycamLightBudgetTest;
+
+	int32 Failures = 0;
+	FBodycamLightBudget Budget = MakeBudget();
+	check(BandMs > Budget.TargetMs * Budget.RecoverRatio && BandMs < Budget.TargetMs);
+
+	Feed(Budget, UnderMs, 1000);
+	BODYCAM_CHECK(Budget.GetLevel() == 0, "under budget holds full quality");
+
+	Feed(Budget, 100.f, 1);
+	Feed(Budget, UnderMs, 200);
+	BODYCAM_CHECK(Budget.GetLevel() == 0, "a one-frame hitch does not degrade");
+
+	// the EMA needs a few samples to cross the target, then OverBudgetFrames more
+	const int32 FirstStep = FramesToChange(Budget, OverMs, 1000);
+	UE_LOG(LogBodycam, Display, TEXT("  first degrade after %d frames over budget"), FirstStep);
+	BODYCAM_CHECK(FirstStep >= Budget.OverBudgetFrames && FirstStep <= Budget.OverBudgetFrames * 2 && Budget.GetLevel() == 1,
+		"a sustained overrun degrades one level after OverBudgetFrames");
+
+	const int32 SecondStep = FramesToChange(Budget, OverMs, 1000);
+	BODYCAM_CHECK(SecondStep == Budget.OverBudgetFrames && Budget.GetLevel() == 2, "each further level takes OverBudgetFrames");
+
+	const int32 DegradeJump = Feed(Budget, OverMs, Budget.OverBudgetFrames * (Budget.MaxLevel + 2));
+	BODYCAM_CHECK(DegradeJump <= 1 && Budget.GetLevel() == Budget.MaxLevel, "degrades one level at a time up to MaxLevel and no further");
+
+	// smoothed value settles inside the band: nothing moves either way
+	Feed(Budget, BandMs, 200);
+	const int32 HeldLevel = Budget.GetLevel();
+	Feed(Budget, BandMs, Budget.RecoverFrames * 4);
+	BODYCAM_CHECK(Budget.GetLevel() == HeldLevel, "inside the hysteresis band the level holds");
+
+	bool bHeldOscillating = true;
+	for (int32 i = 0; i < Budget.RecoverFrames * 4; ++i)
+	{
+		Budget.AddSample((i & 1) ? BandMs + 1.f : BandMs - 1.f);
+		bHeldOscillating &= Budget.GetLevel() == HeldLevel;
+	}
+	BODYCAM_CHECK(bHeldOscillating, "a series oscillating inside the band holds");
+
+	const int32 FirstRecover = FramesToChange(Budget, UnderMs, 1000);
+	UE_LOG(LogBodycam, Display, TEXT("  first recovery after %d frames under budget"), FirstRecover);
+	BODYCAM_CHECK(FirstRecover >= Budget.RecoverFrames && FirstRecover <= Budget.RecoverFrames + Budget.OverBudgetFrames && Budget.GetLevel() == HeldLevel - 1,
+		"recovery steps back one level after RecoverFrames");
+
+	const int32 RecoverJump = Feed(Budget, UnderMs, Budget.RecoverFrames * (Budget.MaxLevel + 1));
+	BODYCAM_CHECK(RecoverJump <= 1 && Budget.GetLevel() == 0, "recovers one level at a time back to full quality");
+
+	// most of a recovery, then back into the band: the count starts over
+	Feed(Budget, OverMs, 100);
+	Feed(Budget, BandMs, 200);
+	const int32 Level = Budget.GetLevel();
+	Feed(Budget, UnderMs, Budget.RecoverFrames - 20);
+	Feed(Budget, BandMs, 200);
+	const int32 Restarted = FramesToChange(Budget, UnderMs, 1000);
+	BODYCAM_CHECK(Level > 0 && Budget.GetLevel() == Level - 1 && Restarted >= Budget.RecoverFrames, "recovery needs RecoverFrames in a row under the band");
+	Budget.Reset();
+
+	BODYCAM_CHECK(Budget.GetLevel() == 0 && Budget.GetSmoothedMs() == 0.f, "reset returns to full quality");
+
+	// NPC lights go first, the locally viewed one last
+	bool bOrdered = true;
+	for (int32 L = 0; L <= Budget.MaxLevel; ++L)
+	{
+		const int32 Local  = UBodycamFlashlightGovernor::GetLightSteps(L, 0);
+		const int32 Remote = UBodycamFlashlightGovernor::GetLightSteps(L, 1);
+		const int32 Npc    = UBodycamFlashlightGovernor::GetLightSteps(L, 2);
+		bOrdered &= Npc >= Remote && Remote >= Local;
+	}
+	BODYCAM_CHECK(bOrdered, "NPC lights degrade before remote players', remote before the local view");
+	BODYCAM_CHECK(UBodycamFlashlightGovernor::GetLightSteps(Budget.MaxLevel, 0) == UBodycamFlashlightGovernor::NumSteps, "every light is fully degraded at MaxLevel");
+
+	if (Failures > 0)
+	{
+		UE_LOG(LogBodycam, Error, TEXT("LightBudget: %d check(s) failed"), Failures);
+		return 1;
+	}
+	UE_LOG(LogBodycam, Display, TEXT("LightBudget: all checks passed"));
+	return 0;
+}
@@ -0,0 +1,30 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BodycamLightBudgetCommandlet.generated.h"
+
+/**
+ * Headless checks for the flashlight governor's budget logic (FBodycamLightBudget), fed with
+ * synthetic frame-time series.
+ *
+ *   UnrealEditor-Cmd BodycamHorrorGame -run=BodycamLightBudget -nullrhi -unattended
+ *
+ * Under budget holds full quality; a one-frame hitch and a series oscillating inside the
+ * hysteresis band change nothing; a sustained overrun degrades one level per OverBudgetFrames
+ * up to MaxLevel and no further; recovery below Target * RecoverRatio steps back one level per
+ * RecoverFrames. Also checks that NPC lights give up quality before remote players' and those
+ * before the locally viewed light. Returns non-zero when a check fails.
+ */
+UCLASS()
+class UBodycamLightBudgetCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBodycamLightBudgetCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,137 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamLightProximity.h"
+#include "HAL/IConsoleManager.h"
+
+static bool GBodycamProximityEnable = true;
+static FAutoConsoleVariableRef CVarBodycamProximityEnable(
+	TEXT("bodycam.Flashlight.Proximity"),
+	GBodycamProximityEnable,
+	TEXT("Dim / widen flashlights pointed at close surfaces and shrink their radius to what they can reach."));
+
+static int32 GBodycamProximityRays = 5;
+static FAutoConsoleVariableRef CVarBodycamProximityRays(
+	TEXT("bodycam.Flashlight.Proximity.Rays"),
+	GBodycamProximityRays,
+	TEXT("Rays per flashlight fan: one down the beam, the rest in a ring across the cone (1..9)."));
+
+static float GBodycamProximityMinRate = 4.f;
+static FAutoConsoleVariableRef CVarBodycamProximityMinRate(
+	TEXT("bodycam.Flashlight.Proximity.MinRate"),
+	GBodycamProximityMinRate,
+	TEXT("Fans per second for a flashlight that holds still; sweeping ones get one every frame."));
+
+static float GBodycamProximityNearDistance = 80.f;
+static FAutoConsoleVariableRef CVarBodycamProximityNearDistance(
+	TEXT("bodycam.Flashlight.Proximity.NearDistance"),
+	GBodycamProximityNearDistance,
+	TEXT("Surfaces this close (cm) get the fully dimmed, widened beam."));
+
+static float GBodycamProximityFarDistance = 700.f;
+static FAutoConsoleVariableRef CVarBodycamProximityFarDistance(
+	TEXT("bodycam.Flashlight.Proximity.FarDistance"),
+	GBodycamProximityFarDistance,
+	TEXT("Surfaces beyond this (cm) leave the beam as authored."));
+
+FBodycamLightProximity FBodycamLightProximity::FromConsole()
+{
+	FBodycamLightProximity P;
+	P.bEnabled     = GBodycamProximityEnable;
+	P.NumRays      = FMath::Clamp(GBodycamProximityRays, 1, MaxRays);
+	P.MinTraceRate = GBodycamProximityMinRate;
+	P.NearDistance = GBodycamProximityNearDistance;
+	P.FarDistance  = FMath::Max(P.NearDistance + 1.f, GBodycamProximityFarDistance);
+	return P;
+}
+
+int32 FBodycamLightProximity::GetRayDirections(const FVector& Forward, float OuterConeDeg, FVector (&OutDirs)[MaxRays]) const
+{
+	const int32 Num = FMath::Clamp(NumRays, 1, MaxRays);
+	OutDirs[0] = Forward;
+
+	// roll-free basis, so the ring does not spin as the beam turns
+	const FRotationMatrix Basis(Forward.Rotation());
+	const FVector Right = Basis.GetUnitAxis(EAxis::Y);
+	const FVector Up    = Basis.GetUnitAxis(EAxis::Z);
+
+	float SinRing, CosRing;
+	FMath::SinCos(&SinRing, &CosRing, FMath::DegreesToRadians(OuterConeDeg * RingFraction));
+	for (int32 i = 1; i < Num; ++i)
+	{
+		float SinAround, CosAround;
+		FMath::SinCos(&SinAround, &CosAround, 2.f * PI * (i - 1) / (Num - 1));
+		OutDirs[i] = Forward * CosRing + (Right * CosAround + Up * SinAround) * SinRing;
+	}
+	return Num;
+}
+
+float FBodycamLightProximity::GetFanInterval(float AimDegPerSec, float MoveCmPerSec) const
+{
+	if (MinTraceRate <= 0.f)
+	{
+		return 0.f;
+	}
+	const float Speed = AimDegPerSec + MoveCmPerSec * MoveToDeg;
+	return FMath::Lerp(1.f / MinTraceRate, 0.f, FMath::Clamp(Speed / FastAimSpeed, 0.f, 1.f));
+}
+
+void FBodycamLightProximity::AddFan(FState& State, TConstArrayView<float> Distances) const
+{
+	if (Distances.Num() == 0)
+	{
+		return;
+	}
+	// anything close in the beam blooms; the farthest hit is what the light can still reach
+	State.TargetNear = Distances[0];
+	State.TargetFar  = Distances[0];
+	for (float D : Distances)
+	{
+		State.TargetNear = FMath::Min(State.TargetNear, D);
+		State.TargetFar  = FMath::Max(State.TargetFar, D);
+	}
+}
+
+void FBodycamLightProximity::Smooth(FState& State, float DeltaSeconds) const
+{
+	if (State.TargetNear < 0.f)
+	{
+		return;
+	}
+	if (State.Near < 0.f)
+	{
+		State.Near = State.TargetNear;
+		State.Far  = State.TargetFar;
+		return;
+	}
+	State.Near = FMath::FInterpTo(State.Near, State.TargetNear, DeltaSeconds, State.TargetNear < State.Near ? CloserSpeed : FartherSpeed);
+	State.Far  = FMath::FInterpTo(State.Far,  State.TargetFar,  DeltaSeconds, State.TargetFar  < State.Far  ? CloserSpeed : FartherSpeed);
+}
+
+float FBodycamLightProximity::GetNearAlpha(const FState& State) const
+{
+	if (State.Near < 0.f)
+	{
+		return 1.f;
+	}
+	return FMath::SmoothStep(NearDistance, FarDistance, State.Near);
+}
+
+float FBodycamLightProximity::GetIntensityScale(const FState& State) const
+{
+	return FMath::Lerp(NearIntensityScale, 1.f, GetNearAlpha(State));
+}
+
+float FBodycamLightProximity::GetConeScale(const FState& State) const
+{
+	return FMath::Lerp(NearConeScale, 1.f, GetNearAlpha(State));
+}
+
+float FBodycamLightProximity::GetAttenuationRadius(const FState& State, float AuthoredRadius) const
+{
+	if (State.Far < 0.f)
+	{
+		return AuthoredRadius;
+	}
+	return FMath::Min(AuthoredRadius, FMath::Max(MinRadius, State.Far + RadiusMargin));
+}
@@ -0,0 +1,72 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Flashlight proximity adaptation, world-free: a small fan of rays across the beam says how far
+ * the lit surface is. A close surface dims and widens the beam (otherwise it blooms like no real
+ * bodycam light does), and the attenuation radius shrinks to what the fan can reach, which
+ * indoors also cuts what the light has to shadow. UBodycamFlashlightGovernor batches the async
+ * traces for every active flashlight and applies the result on top of its budget steps.
+ *
+ * Results arrive a frame after the fan is issued and are smoothed, faster towards a nearer
+ * surface (dim before it blooms) than away from it. Fans go out every frame while the beam
+ * sweeps and down to MinTraceRate while it holds still.
+ */
+struct BODYCAMHORRORGAME_API FBodycamLightProximity
+{
+	static constexpr int32 MaxRays = 9;
+
+	bool  bEnabled = true;
+	int32 NumRays = 5;                // centre + ring
+	float RingFraction = 0.7f;        // ring angle, fraction of the outer cone
+	float NearDistance = 80.f;        // cm: fully dimmed / widened at or below
+	float FarDistance = 700.f;        // cm: untouched beyond
+	float NearIntensityScale = 0.35f;
+	float NearConeScale = 1.2f;
+	float RadiusMargin = 300.f;       // cm kept past the farthest hit
+	float MinRadius = 800.f;
+	float CloserSpeed = 14.f;         // smoothing (1/s) towards a nearer surface
+	float FartherSpeed = 4.f;         // ... and towards a farther one
+	float MinTraceRate = 4.f;         // Hz while the beam holds still
+	float FastAimSpeed = 120.f;       // deg/s at which every frame gets a fan
+	float MoveToDeg = 0.05f;          // walking 300 cm/s counts like turning 15 deg/s
+
+	/** Per-light state (distances in cm, < 0 = no result yet). */
+	struct FState
+	{
+		float TargetNear = -1.f;
+		float TargetFar = -1.f;
+		float Near = -1.f;
+		float Far = -1.f;
+		double LastFanSeconds = -1.0;
+	};
+
+	/** Current bodycam.Flashlight.Proximity.* values. */
+	static FBodycamLightProximity FromConsole();
+
+	/** Fan directions for a beam along Forward (unit) with the given outer cone angle; returns the count. */
+	int32 GetRayDirections(const FVector& Forward, float OuterConeDeg, FVector (&OutDirs)[MaxRays]) const;
+
+	/** Seconds between fans for a beam turning (deg/s) and moving (cm/s) this fast; 0 = every frame. */
+	float GetFanInterval(float AimDegPerSec, float MoveCmPerSec) const;
+
+	/** One fan's hit distances, Range for the rays that hit nothing. */
+	void AddFan(FState& State, TConstArrayView<float> Distances) const;
+
+	/** Moves the smoothed distances towards the last fan; the first fan is taken as is. */
+	void Smooth(FState& State, float DeltaSeconds) const;
+
+	/** 1 with no result yet. */
+	float GetIntensityScale(const FState& State) const;
+	float GetConeScale(const FState& State) const;
+
+	/** Authored radius with no result yet, never above it. */
+	float GetAttenuationRadius(const FState& State, float AuthoredRadius) const;
+
+private:
+	// 0 at NearDistance or closer, 1 at FarDistance or beyond
+	float GetNearAlpha(const FState& State) const;
+};
@@ -0,0 +1,399 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamLitQuery.h"
+#include "BodycamHorrorGame.h"
+#include "Components/SpotLightComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+
+static int32 GBodycamLitMaxTraces = 32;
+static FAutoConsoleVariableRef CVarBodycamLitMaxTraces(
+	TEXT("bodycam.LitQuery.MaxTraces"),
+	GBodycamLitMaxTraces,
+	TEXT("Occlusion traces the lit query issues per frame; lit targets beyond this reuse their last result."));
+
+static int32 GBodycamLitMaxLights = 4;
+static FAutoConsoleVariableRef CVarBodycamLitMaxLights(
+	TEXT("bodycam.LitQuery.MaxLights"),
+	GBodycamLitMaxLights,
+	TEXT("Flashlight cones the lit query tests per frame (first visible ones in registration order)."));
+
+static int32 GBodycamLitMaxTargetUpdates = 128;
+static FAutoConsoleVariableRef CVarBodycamLitMaxTargetUpdates(
+	TEXT("bodycam.LitQuery.MaxTargetUpdates"),
+	GBodycamLitMaxTargetUpdates,
+	TEXT("Target positions the lit query refreshes per frame, round-robin; with more targets a position can be a few frames old."));
+
+namespace BodycamLitQuery
+{
+	static constexpr float CellSize = 800.f;     // cm, about a third of the default beam range
+	static constexpr float MoveThreshold = 10.f; // cm a target moves before its position and cell are rewritten
+}
+
+void UBodycamLitQuerySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Hash = FBodycamSpatialHash(BodycamLitQuery::CellSize);
+}
+
+void UBodycamLitQuerySubsystem::RegisterTarget(AActor* Actor, float InRadius)
+{
+	if (!Actor)
+	{
+		return;
+	}
+	LLM_SCOPE_BYTAG(Bodycam);
+
+	const float TargetRadius = FMath::Max(0.f, InRadius);
+	MaxRadius = FMath::Max(MaxRadius, TargetRadius);
+
+	if (const int32* Existing = IndexByActor.Find(Actor))
+	{
+		Radius[*Existing] = TargetRadius;
+		return;
+	}
+
+	const FVector Loc = Actor->GetActorLocation();
+	const int32 Index = Hash.Add(Loc);
+	Targets.Add(Actor);
+	PosX.Add((float)Loc.X);
+	PosY.Add((float)Loc.Y);
+	PosZ.Add((float)Loc.Z);
+	Radius.Add(TargetRadius);
+	ConeExposure.Add(0.f);
+	BestCone.Add(INDEX_NONE);
+	ConeFrame.Add(0);
+	bVisible.Add(0);
+	LastTraceFrame.Add(0);
+	IndexByActor.Add(Actor, Index);
+	check(Targets.Num() == Hash.Num());
+}
+
+void UBodycamLitQuerySubsystem::UnregisterTarget(AActor* Actor)
+{
+	if (const int32* Index = IndexByActor.Find(Actor))
+	{
+		RemoveTargetAt(*Index);
+	}
+}
+
+void UBodycamLitQuerySubsystem::RemoveTargetAt(int32 Index)
+{
+	IndexByActor.Remove(Targets[Index]);
+	Hash.RemoveAtSwap(Index);
+
+	auto RemoveSwap = [Index](auto& Array) { Array.RemoveAtSwap(Index, 1, EAllowShrinking::No); };
+	RemoveSwap(Targets);
+	RemoveSwap(PosX);
+	RemoveSwap(PosY);
+	RemoveSwap(PosZ);
+	RemoveSwap(Radius);
+	RemoveSwap(ConeExposure);
+	RemoveSwap(BestCone);
+	RemoveSwap(ConeFrame);
+	RemoveSwap(bVisible);
+	RemoveSwap(LastTraceFrame);
+
+	// the last target now lives in the freed slot
+	if (Targets.IsValidIndex(Index))
+	{
+		IndexByActor.Add(Targets[Index], Index);
+	}
+}
+
+void UBodycamLitQuerySubsystem::RegisterLight(USpotLightComponent* Light)
+{
+	if (Light)
+	{
+		LLM_SCOPE_BYTAG(Bodycam);
+		Lights.AddUnique(Light);
+	}
+}
+
+void UBodycamLitQuerySubsystem::UnregisterLight(USpotLightComponent* Light)
+{
+	Lights.RemoveAllSwap([Light](const TWeakObjectPtr<USpotLightComponent>& L) { return !L.IsValid() || L == Light; });
+}
+
+float UBodycamLitQuerySubsystem::GetExposure(const AActor* Actor) const
+{
+	const int32* Index = IndexByActor.Find(Actor);
+	return Index ? GetExposureAt(*Index) : 0.f;
+}
+
+float UBodycamLitQuerySubsystem::GetExposureAt(int32 Index) const
+{
+	return ConeFrame[Index] == UpdateCount && bVisible[Index] ? ConeExposure[Index] : 0.f;
+}
+
+void UBodycamLitQuerySubsystem::GetLitActors(TArray<AActor*>& OutActors, float MinExposure) const
+{
+	OutActors.Reset();
+	for (int32 i = 0; i < Targets.Num(); ++i)
+	{
+		const float TargetExposure = GetExposureAt(i);
+		if (TargetExposure > 0.f && TargetExposure >= MinExposure)
+		{
+			if (AActor* Actor = Targets[i].ResolveObjectPtr())
+			{
+				OutActors.Add(Actor);
+			}
+		}
+	}
+}
+
+void UBodycamLitQuerySubsystem::ResolveTraces()
+{
+	UWorld* World = GetWorld();
+	for (const FPendingTrace& Pending : PendingTraces)
+	{
+		FTraceDatum Datum;
+		const int32* Index = IndexByActor.Find(Pending.Target);
+		if (Index && World->QueryTraceData(Pending.Handle, Datum))
+		{
+			bVisible[*Index] = FHitResult::GetFirstBlockingHit(Datum.OutHits) == nullptr;
+		}
+	}
+	PendingTraces.Reset();
+}
+
+void UBodycamLitQuerySubsystem::UpdateTargets()
+{
+	const int32 Budget = FMath::Min(Targets.Num(), FMath::Max(1, GBodycamLitMaxTargetUpdates));
+	for (int32 n = 0; n < Budget && Targets.Num() > 0; ++n)
+	{
+		if (UpdateCursor >= Targets.Num())
+		{
+			UpdateCursor = 0;
+		}
+		const int32 i = UpdateCursor;
+
+		const AActor* Actor = Targets[i].ResolveObjectPtr();
+		if (!Actor)
+		{
+			// the last target moved into this slot; it is next
+			RemoveTargetAt(i);
+			continue;
+		}
+		++UpdateCursor;
+
+		const FVector Loc = Actor->GetActorLocation();
+		if (FVector::DistSquared(Loc, FVector(PosX[i], PosY[i], PosZ[i])) > FMath::Square(BodycamLitQuery::MoveThreshold))
+		{
+			PosX[i] = (float)Loc.X;
+			PosY[i] = (float)Loc.Y;
+			PosZ[i] = (float)Loc.Z;
+			Hash.Update(i, Loc);
+		}
+	}
+}
+
+void UBodycamLitQuerySubsystem::GatherCones()
+{
+	Cones.Reset();
+	Lights.RemoveAllSwap([](const TWeakObjectPtr<USpotLightComponent>& L) { return !L.IsValid(); });
+
+	for (const TWeakObjectPtr<USpotLightComponent>& LightPtr : Lights)
+	{
+		const USpotLightComponent* Light = LightPtr.Get();
+		if (Cones.Num() >= FMath::Min(GBodycamLitMaxLights, (int32)MAX_int8))
+		{
+			break;
+		}
+		if (!Light->IsVisible() || Light->Intensity <= 0.f || Light->AttenuationRadius <= 0.f)
+		{
+			continue;
+		}
+
+		// outer capped below the renderer's 89 deg so the culling box stays finite
+		const float Outer = FMath::DegreesToRadians(FMath::Clamp(Light->OuterConeAngle, 1.f, 80.f));
+		const float Inner = FMath::DegreesToRadians(FMath::Clamp(Light->InnerConeAngle, 0.f, Light->OuterConeAngle - 0.001f));
+
+		FCone& Cone = Cones.AddDefaulted_GetRef();
+		Cone.Apex        = FVector3f(Light->GetComponentLocation());
+		Cone.Dir         = FVector3f(Light->GetForwardVector());
+		Cone.Range       = Light->AttenuationRadius;
+		Cone.CosOuter    = FMath::Cos(Outer);
+		Cone.SinOuter    = FMath::Sin(Outer);
+		Cone.InvCosDelta = 1.f / FMath::Max(FMath::Cos(Inner) - Cone.CosOuter, 0.001f);
+		Cone.bInverseSquared = Light->bUseInverseSquaredFalloff;
+		Cone.FalloffExponent = Cone.bInverseSquared ? 2.f : FMath::Max(Light->LightFalloffExponent, UE_KINDA_SMALL_NUMBER);
+		Cone.Owner       = Light->GetOwner();
+	}
+}
+
+void UBodycamLitQuerySubsystem::CullCone(const FCone& Cone, int32 ConeIndex)
+{
+	// box around the cone cut off at its range (apex + far disk), grown by the largest target
+	const FVector3f Far = Cone.Apex + Cone.Dir * Cone.Range;
+	const float DiskRadius = Cone.Range * Cone.SinOuter / Cone.CosOuter;
+	const FVector3f DiskExtent(
+		DiskRadius * FMath::Sqrt(FMath::Max(0.f, 1.f - Cone.Dir.X * Cone.Dir.X)),
+		DiskRadius * FMath::Sqrt(FMath::Max(0.f, 1.f - Cone.Dir.Y * Cone.Dir.Y)),
+		DiskRadius * FMath::Sqrt(FMath::Max(0.f, 1.f - Cone.Dir.Z * Cone.Dir.Z)));
+	FBox Box(FVector(Cone.Apex), FVector(Cone.Apex));
+	Box += FVector(Far - DiskExtent);
+	Box += FVector(Far + DiskExtent);
+
+	Candidates.Reset();
+	Hash.Query(Box.ExpandBy(MaxRadius + BodycamLitQuery::MoveThreshold), Candidates);
+	const int32 Num = Candidates.Num();
+	if (Num == 0)
+	{
+		return;
+	}
+	INC_DWORD_STAT_BY(STAT_BodycamLitCandidates, Num);
+
+	// gather into padded arrays so the loop below always loads four lanes; padding sits on the
+	// apex, which the in-front test rejects
+	const int32 NumPadded = Align(Num, 4);
+	CandX.SetNumUninitialized(NumPadded, EAllowShrinking::No);
+	CandY.SetNumUninitialized(NumPadded, EAllowShrinking::No);
+	CandZ.SetNumUninitialized(NumPadded, EAllowShrinking::No);
+	CandR.SetNumUninitialized(NumPadded, EAllowShrinking::No);
+	CandExposure.SetNumUninitialized(NumPadded, EAllowShrinking::No);
+	for (int32 c = 0; c < NumPadded; ++c)
+	{
+		const bool bReal = c < Num;
+		const int32 i = bReal ? Candidates[c] : 0;
+		CandX[c] = bReal ? PosX[i] : Cone.Apex.X;
+		CandY[c] = bReal ? PosY[i] : Cone.Apex.Y;
+		CandZ[c] = bReal ? PosZ[i] : Cone.Apex.Z;
+		CandR[c] = bReal ? Radius[i] : 0.f;
+	}
+
+	const VectorRegister4Float Zero        = VectorZeroFloat();
+	const VectorRegister4Float One         = VectorOneFloat();
+	const VectorRegister4Float Tiny        = VectorSetFloat1(UE_KINDA_SMALL_NUMBER);
+	const VectorRegister4Float ApexX       = VectorSetFloat1(Cone.Apex.X);
+	const VectorRegister4Float ApexY       = VectorSetFloat1(Cone.Apex.Y);
+	const VectorRegister4Float ApexZ       = VectorSetFloat1(Cone.Apex.Z);
+	const VectorRegister4Float DirX        = VectorSetFloat1(Cone.Dir.X);
+	const VectorRegister4Float DirY        = VectorSetFloat1(Cone.Dir.Y);
+	const VectorRegister4Float DirZ        = VectorSetFloat1(Cone.Dir.Z);
+	const VectorRegister4Float CosOuter    = VectorSetFloat1(Cone.CosOuter);
+	const VectorRegister4Float InvCosDelta = VectorSetFloat1(Cone.InvCosDelta);
+	const VectorRegister4Float InvRangeSq  = VectorSetFloat1(1.f / FMath::Square(Cone.Range));
+	const VectorRegister4Float FalloffExp  = VectorSetFloat1(Cone.FalloffExponent);
+	const bool bSquareFalloff = Cone.FalloffExponent == 2.f;
+
+	for (int32 c = 0; c < NumPadded; c += 4)
+	{
+		const VectorRegister4Float Vx = VectorSubtract(VectorLoad(&CandX[c]), ApexX);
+		const VectorRegister4Float Vy = VectorSubtract(VectorLoad(&CandY[c]), ApexY);
+		const VectorRegister4Float Vz = VectorSubtract(VectorLoad(&CandZ[c]), ApexZ);
+		const VectorRegister4Float R  = VectorLoad(&CandR[c]);
+
+		const VectorRegister4Float Along  = VectorMultiplyAdd(Vx, DirX, VectorMultiplyAdd(Vy, DirY, VectorMultiply(Vz, DirZ)));
+		const VectorRegister4Float DistSq = VectorMultiplyAdd(Vx, Vx, VectorMultiplyAdd(Vy, Vy, VectorMultiply(Vz, Vz)));
+
+		// angle to the nearest point of the target: pull it toward the axis by its radius
+		const VectorRegister4Float Perp    = VectorSqrt(VectorMax(VectorSubtract(DistSq, VectorMultiply(Along, Along)), Zero));
+		const VectorRegister4Float PerpEff = VectorMax(VectorSubtract(Perp, R), Zero);
+		const VectorRegister4Float LenEff  = VectorSqrt(VectorMax(VectorMultiplyAdd(Along, Along, VectorMultiply(PerpEff, PerpEff)), Tiny));
+		const VectorRegister4Float CosEff  = VectorDivide(Along, LenEff);
+
+		// spot falloff: Square(saturate((cos - cos outer) / (cos inner - cos outer)))
+		VectorRegister4Float Spot = VectorMin(VectorMax(VectorMultiply(VectorSubtract(CosEff, CosOuter), InvCosDelta), Zero), One);
+		Spot = VectorMultiply(Spot, Spot);
+
+		// distance falloff as the renderer does it, measured to the near side: pow(saturate(1 - (d / range)^2),
+		// LightFalloffExponent), or for inverse squared lights just the window Square(saturate(1 - (d / range)^4))
+		// (the 1 / d^2 term is intensity, not coverage)
+		const VectorRegister4Float DistEff = VectorMax(VectorSubtract(VectorSqrt(DistSq), R), Zero);
+		VectorRegister4Float DistNorm = VectorMultiply(VectorMultiply(DistEff, DistEff), InvRangeSq);
+		if (Cone.bInverseSquared)
+		{
+			DistNorm = VectorMultiply(DistNorm, DistNorm);
+		}
+		const VectorRegister4Float Window = VectorMax(VectorSubtract(One, DistNorm), Zero);
+		const VectorRegister4Float Atten = bSquareFalloff ? VectorMultiply(Window, Window) : VectorPow(Window, FalloffExp);
+
+		const VectorRegister4Float InFront = VectorCompareGT(Along, Zero);
+		VectorStore(VectorSelect(InFront, VectorMultiply(Spot, Atten), Zero), &CandExposure[c]);
+	}
+
+	// best light wins; the first cone to reach a target this frame overwrites last frame's result
+	for (int32 c = 0; c < Num; ++c)
+	{
+		const int32 i = Candidates[c];
+		if (CandExposure[c] <= 0.f)
+		{
+			continue;
+		}
+		if (ConeFrame[i] != UpdateCount)
+		{
+			// out of every beam last frame: needs a fresh trace before it counts as visible
+			if (ConeFrame[i] != UpdateCount - 1)
+			{
+				bVisible[i] = 0;
+			}
+			ConeFrame[i] = UpdateCount;
+			ConeExposure[i] = CandExposure[c];
+			BestCone[i] = static_cast<int8>(ConeIndex);
+			TraceOrder.Add(i);
+		}
+		else if (CandExposure[c] > ConeExposure[i])
+		{
+			ConeExposure[i] = CandExposure[c];
+			BestCone[i] = static_cast<int8>(ConeIndex);
+		}
+	}
+}
+
+void UBodycamLitQuerySubsystem::IssueTraces()
+{
+	// oldest result first, so every lit target gets re-traced within a few frames
+	const int32 NumTraces = FMath::Min(TraceOrder.Num(), FMath::Max(0, GBodycamLitMaxTraces));
+	if (NumTraces < TraceOrder.Num())
+	{
+		TraceOrder.Sort([this](int32 A, int32 B) { return LastTraceFrame[A] < LastTraceFrame[B]; });
+	}
+
+	UWorld* World = GetWorld();
+	for (int32 t = 0; t < NumTraces; ++t)
+	{
+		const int32 i = TraceOrder[t];
+		const FCone& Cone = Cones[BestCone[i]];
+
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(BodycamLitQuery), false, Cone.Owner);
+		Params.AddIgnoredActor(Targets[i].ResolveObjectPtr());
+
+		FPendingTrace& Pending = PendingTraces.AddDefaulted_GetRef();
+		Pending.Handle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, FVector(Cone.Apex), FVector(PosX[i], PosY[i], PosZ[i]), ECC_Visibility, Params);
+		Pending.Target = Targets[i];
+		LastTraceFrame[i] = UpdateCount;
+	}
+	INC_DWORD_STAT_BY(STAT_BodycamLitTraces, NumTraces);
+}
+
+void UBodycamLitQuerySubsystem::Tick(float DeltaTime)
+{
+	BODYCAM_SCOPE(STAT_BodycamLitQuery, BodycamLitQuery);
+
+	++UpdateCount;
+	ResolveTraces();
+	UpdateTargets();
+	GatherCones();
+
+	TraceOrder.Reset();
+	for (int32 c = 0; c < Cones.Num(); ++c)
+	{
+		CullCone(Cones[c], c);
+	}
+
+	IssueTraces();
+}
+
+TStatId UBodycamLitQuerySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBodycamLitQuerySubsystem, STATGROUP_Bodycam);
+}
+
+bool UBodycamLitQuerySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,113 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "BodycamSpatialHash.h"
+#include "BodycamLitQuery.generated.h"
+
+class USpotLightComponent;
+
+/**
+ * "Who is lit": how much of each registered light-sensitive actor (enemy, prop) sits in a
+ * flashlight beam. Targets live in a spatial hash; every frame each active flashlight cone pulls
+ * the cells it overlaps, runs cone + attenuation on the candidates four at a time, and only the
+ * survivors get an async occlusion trace (bodycam.LitQuery.MaxTraces per frame, oldest first).
+ *
+ * Nothing walks every target per frame: positions are refreshed round-robin
+ * (bodycam.LitQuery.MaxTargetUpdates per frame, re-bucketed only when a target moved more than a
+ * few cm) and per-frame cone results are stamped with the update count instead of cleared, so
+ * the cost follows the cells the cones cover, not the number of registered targets. With more
+ * targets than the update budget a position can be a few frames old.
+ *
+ * Exposure is 0..1 (spot falloff * the light's distance falloff, best light wins). Trace results
+ * arrive a frame later, so a target entering a beam reads 0 for a frame or two.
+ */
+UCLASS()
+class BODYCAMHORRORGAME_API UBodycamLitQuerySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Radius (cm) is the target's bounding sphere around its actor location. */
+	UFUNCTION(BlueprintCallable, Category="Bodycam|Lit")
+	void RegisterTarget(AActor* Actor, float Radius = 50.f);
+
+	UFUNCTION(BlueprintCallable, Category="Bodycam|Lit")
+	void UnregisterTarget(AActor* Actor);
+
+	void RegisterLight(USpotLightComponent* Light);
+	void UnregisterLight(USpotLightComponent* Light);
+
+	/** Exposure from the last update (0 when not registered). */
+	UFUNCTION(BlueprintPure, Category="Bodycam|Lit")
+	float GetExposure(const AActor* Actor) const;
+
+	/** Targets with at least MinExposure. */
+	UFUNCTION(BlueprintCallable, Category="Bodycam|Lit")
+	void GetLitActors(TArray<AActor*>& OutActors, float MinExposure = 0.05f) const;
+
+	int32 GetNumTargets() const { return Targets.Num(); }
+
+	// UTickableWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FCone
+	{
+		FVector3f Apex = FVector3f::ZeroVector;
+		FVector3f Dir  = FVector3f::ForwardVector;
+		float Range = 0.f;
+		float CosOuter = 0.f;
+		float SinOuter = 0.f;
+		float InvCosDelta = 0.f; // 1 / (cos inner - cos outer)
+		float FalloffExponent = 2.f;
+		bool bInverseSquared = false;
+		const AActor* Owner = nullptr;
+	};
+
+	struct FPendingTrace
+	{
+		FTraceHandle Handle;
+		TObjectKey<AActor> Target;
+	};
+
+	float GetExposureAt(int32 Index) const;
+	void RemoveTargetAt(int32 Index);
+	void UpdateTargets();
+	void ResolveTraces();
+	void GatherCones();
+	void CullCone(const FCone& Cone, int32 ConeIndex);
+	void IssueTraces();
+
+	// targets (struct-of-arrays, indices shared with Hash)
+	TArray<TObjectKey<AActor>> Targets;
+	TArray<float> PosX, PosY, PosZ, Radius;
+	TArray<float> ConeExposure;   // before occlusion, valid when ConeFrame is the current update
+	TArray<int8>  BestCone;
+	TArray<uint32> ConeFrame;     // last update any cone reached the target
+	TArray<uint8> bVisible;       // last trace result
+	TArray<uint32> LastTraceFrame;
+	TMap<TObjectKey<AActor>, int32> IndexByActor;
+	FBodycamSpatialHash Hash;
+	float MaxRadius = 0.f;
+
+	TArray<TWeakObjectPtr<USpotLightComponent>> Lights;
+
+	// scratch, kept between frames so the update does not allocate
+	TArray<FCone> Cones;           // active lights this frame
+	TArray<int32> Candidates;
+	TArray<float> CandX, CandY, CandZ, CandR, CandExposure;
+	TArray<int32> TraceOrder;      // targets some cone reached this frame
+
+	TArray<FPendingTrace> PendingTraces;
+	uint32 UpdateCount = 0;
+	int32 UpdateCursor = 0;        // round-robin position refresh
+};
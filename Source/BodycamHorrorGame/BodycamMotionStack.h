@@ -0,0 +1,254 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BodycamNoiseBank.h"
+#include "BodycamProfile.h"
+
+/**
+ * The camera pivot motion (POV) as a stack of channels put together at compile time. A channel
+ * is a small type with
+ *
+ *   static FResult Evaluate(FBodycamMotionContext& Ctx);            // step its state, compute its share
+ *   static void Accumulate(const FResult& R, FBodycamMotionPose& Pose); // add it to the pose
+ *
+ * TBodycamMotionStack runs its channels in order inside UBodycamMotionSubsystem's solve loop, all
+ * inlined; a channel that is not in a stack is never compiled into it. New channels (recoil,
+ * stumble, ...) go in a stack alias below; per-pawn state a channel needs lives in the
+ * subsystem's arrays and is handed over in the context.
+ */
+
+/** One pawn, one step: inputs, channel state and values earlier channels pass on. */
+struct FBodycamMotionContext
+{
+	const FBodycamTuning& T;
+	const FBodycamNoiseBank& Noise;
+	float DeltaSeconds = 0.f;
+
+	FVector2f Velocity2D = FVector2f::ZeroVector;
+	FVector2f Right2D = FVector2f::ZeroVector;
+	float Speed2D = 0.f;
+	float MaxSpeed = 1.f;
+	float MoveAlpha = 0.f;   // 0..1 of max walk speed
+	float Detail = 1.f;      // 0..1 weight of breathing / bob / roll (fades with significance)
+	bool bGrounded = false;
+	bool bCrouching = false;
+	bool bTakeoff = false;   // this step
+	bool bLanded = false;
+
+	// per-pawn state (elements of the subsystem's arrays)
+	float* BreathPhase[5];   // X, Y, Z, pitch, roll
+	float& BobTime;
+	float& LandingOffset;
+	float& JumpOffset;
+
+	// left by earlier channels
+	float BobScale = 0.f;
+	float BobPhase = 0.f;
+	float BreathNoiseZ = 0.f; // drives the breathing audio level
+};
+
+/** What the channels add up to: pivot offset (cm, pivot space) and pitch / roll (deg). */
+struct FBodycamMotionPose
+{
+	FVector3f Offset = FVector3f::ZeroVector;
+	float Pitch = 0.f;
+	float Roll = 0.f;
+};
+
+template<typename... TChannels>
+struct TBodycamMotionStack
+{
+	/** Channels in order: each sees what the earlier ones left in Ctx, and the pose sums in stack order. */
+	static FORCEINLINE void Evaluate(FBodycamMotionContext& Ctx, FBodycamMotionPose& Pose)
+	{
+		(TChannels::Accumulate(TChannels::Evaluate(Ctx), Pose), ...);
+	}
+
+	/** This stack with more channels on top. */
+	template<typename... TMore>
+	using TWith = TBodycamMotionStack<TChannels..., TMore...>;
+};
+
+// ---------------------------------------------------------------------------------------------
+// Built-in channels
+
+/** Noise-based breathing on all axes, reduced while moving so it does not fight the bob. */
+struct FBodycamBreathChannel
+{
+	struct FResult
+	{
+		FVector3f Offset;
+		float Pitch;
+		float Roll;
+	};
+
+	static FORCEINLINE FResult Evaluate(FBodycamMotionContext& Ctx)
+	{
+		const FBodycamTuning& T = Ctx.T;
+		const float dt = Ctx.DeltaSeconds * T.BreathNoiseSpeed;
+		float& PX = *Ctx.BreathPhase[0];
+		float& PY = *Ctx.BreathPhase[1];
+		float& PZ = *Ctx.BreathPhase[2];
+		float& PP = *Ctx.BreathPhase[3];
+		float& PR = *Ctx.BreathPhase[4];
+		PX = FBodycamNoiseBank::Advance(PX, dt * 0.87f);
+		PY = FBodycamNoiseBank::Advance(PY, dt * 1.03f);
+		PZ = FBodycamNoiseBank::Advance(PZ, dt * 1.19f);
+		PP = FBodycamNoiseBank::Advance(PP, dt * 0.77f);
+		PR = FBodycamNoiseBank::Advance(PR, dt * 0.93f);
+
+		// Perlin noise in [-1,1] per channel (table lookup)
+		const float nx = Ctx.Noise.Sample(PX);
+		const float ny = Ctx.Noise.Sample(PY);
+		const float nz = Ctx.Noise.Sample(PZ);
+		const float np = Ctx.Noise.Sample(PP);
+		const float nr = Ctx.Noise.Sample(PR);
+		Ctx.BreathNoiseZ = nz;
+
+		const float MoveScale = 1.f - 0.6f * Ctx.MoveAlpha; // keep ~40% at full sprint
+		FResult R;
+		R.Offset = FVector3f(nx * T.BreathXYIntensity * MoveScale, ny * T.BreathXYIntensity * MoveScale, nz * T.BreathIntensity * MoveScale) * Ctx.Detail;
+		R.Pitch  = np * T.BreathPitchDeg * MoveScale * Ctx.Detail;
+		R.Roll   = nr * T.BreathRollDeg  * MoveScale * Ctx.Detail;
+		return R;
+	}
+
+	static FORCEINLINE void Accumulate(const FResult& R, FBodycamMotionPose& Pose)
+	{
+		Pose.Offset += R.Offset;
+		Pose.Pitch  += R.Pitch;
+		Pose.Roll   += R.Roll;
+	}
+};
+
+/** Walk bob on X/Y/Z; owns the bob clock (and so the footfalls) and passes scale + phase on. */
+struct FBodycamBobChannel
+{
+	static FORCEINLINE FVector3f Evaluate(FBodycamMotionContext& Ctx)
+	{
+		const FBodycamTuning& T = Ctx.T;
+		float Scale = 0.f;
+		if (Ctx.bGrounded && Ctx.Speed2D > 10.f)
+		{
+			const float SpeedNorm = FMath::Clamp(Ctx.Speed2D / Ctx.MaxSpeed, 0.f, 2.f);
+			Scale = FMath::Lerp(1.0f, T.SprintBobScale, FMath::Clamp(SpeedNorm - 0.5f, 0.f, 1.f));
+			if (Ctx.bCrouching) Scale *= T.CrouchBobScale;
+
+			Ctx.BobTime += Ctx.DeltaSeconds * T.BobFrequency;
+		}
+		else
+		{
+			Ctx.BobTime = 0.f;
+		}
+
+		const float Phase = Ctx.BobTime * 2.f * PI;
+		Scale *= Ctx.Detail;
+		Ctx.BobScale = Scale;
+		Ctx.BobPhase = Phase;
+
+		const float OffZ = Ctx.bGrounded ?  FMath::Sin(Phase)        * (T.BobIntensity  * Scale) : 0.f;
+		const float OffY = Ctx.bGrounded ?  FMath::Sin(Phase * 0.5f) * (T.BobHorizontal * Scale) : 0.f;
+		const float OffX = Ctx.bGrounded ? -FMath::Cos(Phase)        * (T.BobForward    * Scale) : 0.f;
+		return FVector3f(OffX, OffY, OffZ);
+	}
+
+	static FORCEINLINE void Accumulate(const FVector3f& Offset, FBodycamMotionPose& Pose)
+	{
+		Pose.Offset += Offset;
+	}
+};
+
+/** Nod in step with the bob; goes after FBodycamBobChannel. */
+struct FBodycamBobPitchChannel
+{
+	static FORCEINLINE float Evaluate(FBodycamMotionContext& Ctx)
+	{
+		return FMath::Sin(Ctx.BobPhase + PI * 0.5f) * (Ctx.T.BobPitchDeg * Ctx.BobScale);
+	}
+
+	static FORCEINLINE void Accumulate(float Pitch, FBodycamMotionPose& Pose)
+	{
+		Pose.Pitch += Pitch;
+	}
+};
+
+/** Roll into sideways movement. */
+struct FBodycamStrafeRollChannel
+{
+	static FORCEINLINE float Evaluate(FBodycamMotionContext& Ctx)
+	{
+		const float SizeSq = Ctx.Velocity2D.SizeSquared();
+		const FVector2f Dir = SizeSq > SMALL_NUMBER ? Ctx.Velocity2D * FMath::InvSqrt(SizeSq) : FVector2f::ZeroVector;
+		const float Lateral = FVector2f::DotProduct(Dir, Ctx.Right2D); // -1..1
+		return Lateral * Ctx.T.StrafeRollDeg * Ctx.Detail;
+	}
+
+	static FORCEINLINE void Accumulate(float Roll, FBodycamMotionPose& Pose)
+	{
+		Pose.Roll += Roll;
+	}
+};
+
+/** Dip on landing, easing back out. */
+struct FBodycamLandingChannel
+{
+	static FORCEINLINE float Evaluate(FBodycamMotionContext& Ctx)
+	{
+		if (Ctx.bLanded) Ctx.LandingOffset = Ctx.T.LandingKick;
+		Ctx.LandingOffset = FMath::FInterpTo(Ctx.LandingOffset, 0.f, Ctx.DeltaSeconds, Ctx.T.LandingDamp);
+		return Ctx.LandingOffset;
+	}
+
+	static FORCEINLINE void Accumulate(float Dip, FBodycamMotionPose& Pose)
+	{
+		Pose.Offset.Z -= Dip;
+	}
+};
+
+/** Bump up on takeoff, easing back out. */
+struct FBodycamJumpChannel
+{
+	static FORCEINLINE float Evaluate(FBodycamMotionContext& Ctx)
+	{
+		if (Ctx.bTakeoff) Ctx.JumpOffset = Ctx.T.JumpKickUp;
+		Ctx.JumpOffset = FMath::FInterpTo(Ctx.JumpOffset, 0.f, Ctx.DeltaSeconds, Ctx.T.JumpDamp);
+		return Ctx.JumpOffset;
+	}
+
+	static FORCEINLINE void Accumulate(float Bump, FBodycamMotionPose& Pose)
+	{
+		Pose.Offset.Z += Bump;
+	}
+};
+
+// ---------------------------------------------------------------------------------------------
+// Stacks (picked per profile with FBodycamTuning::MotionStack). The order is part of the
+// result: the player stack sums in the same order the motion always has.
+
+using FBodycamPlayerMotionStack = TBodycamMotionStack<
+	FBodycamBreathChannel,
+	FBodycamBobChannel,
+	FBodycamBobPitchChannel,
+	FBodycamStrafeRollChannel,
+	FBodycamLandingChannel,
+	FBodycamJumpChannel>;
+
+// nobody looks through an NPC's camera closely: keep the gait, drop breathing and strafe roll
+using FBodycamNPCMotionStack = TBodycamMotionStack<
+	FBodycamBobChannel,
+	FBodycamBobPitchChannel,
+	FBodycamLandingChannel,
+	FBodycamJumpChannel>;
+
+// pawns that lost significance (Detail faded to 0): only what a far-off observer could notice
+using FBodycamFarMotionStack = TBodycamMotionStack<
+	FBodycamLandingChannel,
+	FBodycamJumpChannel>;
+
+// scripted shots: breathing and a soft gait, no kicks or roll from the movement
+using FBodycamCinematicMotionStack = TBodycamMotionStack<
+	FBodycamBreathChannel,
+	FBodycamBobChannel,
+	FBodycamBobPitchChannel>;
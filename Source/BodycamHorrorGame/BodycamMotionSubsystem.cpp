@@ -0,0 +1,981 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamMotionSubsystem.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamAllocGuard.h"
+#include "BodycamCameraModifier.h"
+#include "BodycamCharacter.h"
+#include "BodycamNoiseBank.h"
+#include "BodycamAudio.h"
+#include "BodycamMotionStack.h"
+#include "BodycamRecording.h"
+#include "Camera/CameraComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/SpotLightComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+static int32 GBodycamMotionParallelThreshold = 128;
+static FAutoConsoleVariableRef CVarBodycamMotionParallelThreshold(
+	TEXT("bodycam.Motion.ParallelThreshold"),
+	GBodycamMotionParallelThreshold,
+	TEXT("Pawn count at which the bodycam motion solve is split across worker threads."));
+
+static float GBodycamLightUpdateThreshold = 0.01f;
+static FAutoConsoleVariableRef CVarBodycamLightUpdateThreshold(
+	TEXT("bodycam.Motion.LightUpdateThreshold"),
+	GBodycamLightUpdateThreshold,
+	TEXT("Flashlight transform updates smaller than this (deg / cm) are skipped."));
+
+static int32 GBodycamMotionBatchSize = 64;
+static FAutoConsoleVariableRef CVarBodycamMotionBatchSize(
+	TEXT("bodycam.Motion.BatchSize"),
+	GBodycamMotionBatchSize,
+	TEXT("Pawns solved per ParallelFor task."));
+
+static float GBodycamMotionUnviewedRate = 20.f;
+static FAutoConsoleVariableRef CVarBodycamMotionUnviewedRate(
+	TEXT("bodycam.Motion.UnviewedRate"),
+	GBodycamMotionUnviewedRate,
+	TEXT("Updates per second for pawns nobody views through (< 0 = every frame, 0 = frozen)."));
+
+static float GBodycamMotionFixedRate = 0.f;
+static FAutoConsoleVariableRef CVarBodycamMotionFixedRate(
+	TEXT("bodycam.Motion.FixedRate"),
+	GBodycamMotionFixedRate,
+	TEXT("Steps per second for pawns that update every frame, shown interpolated (0 = step with the frame)."));
+
+static int32 GBodycamMotionMaxSubsteps = 4;
+static FAutoConsoleVariableRef CVarBodycamMotionMaxSubsteps(
+	TEXT("bodycam.Motion.MaxSubsteps"),
+	GBodycamMotionMaxSubsteps,
+	TEXT("Most fixed steps a pawn takes in one frame; a longer hitch drops the rest."));
+
+namespace BodycamMotion
+{
+	// longest step a reduced-rate or fixed-rate pawn takes when it catches up (s)
+	static constexpr float MaxCatchUpStep = 0.25f;
+
+	// breath level: idle floor, and how fast it follows (heavy breathing outlasts the sprint)
+	static constexpr float BreathIdleLevel = 0.3f;
+	static constexpr float BreathLevelInterpSpeed = 1.5f;
+
+	// FMath::VInterpTo on float vectors (same snap-to-target rule)
+	FORCEINLINE FVector3f VInterpTo(const FVector3f& Current, const FVector3f& Target, float DeltaTime, float InterpSpeed)
+	{
+		const FVector3f Dist = Target - Current;
+		if (Dist.SizeSquared() < KINDA_SMALL_NUMBER)
+		{
+			return Target;
+		}
+		return Current + Dist * FMath::Clamp(DeltaTime * InterpSpeed, 0.f, 1.f);
+	}
+
+	FORCEINLINE FVector2f SafeNormal(const FVector2f& V)
+	{
+		const float SizeSq = V.SizeSquared();
+		return SizeSq > SMALL_NUMBER ? V * FMath::InvSqrt(SizeSq) : FVector2f::ZeroVector;
+	}
+}
+
+void FBodycamMotionTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Target->Update(DeltaTime);
+	}
+}
+
+FString FBodycamMotionTickFunction::DiagnosticMessage()
+{
+	return TEXT("UBodycamMotionSubsystem[Update]");
+}
+
+FName FBodycamMotionTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("BodycamMotion"));
+}
+
+// ---------------------------------------------------------------------------------------------
+
+void UBodycamMotionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// build the shared breathing table up front, not on a worker thread mid-frame
+	FBodycamNoiseBank::Get();
+
+	// after CharacterMovement (TG_PrePhysics) and physics, before anything that reads the pose
+	MotionTick.Target = this;
+	MotionTick.bCanEverTick = true;
+	MotionTick.bStartWithTickEnabled = true;
+	MotionTick.TickGroup = TG_PostPhysics;
+	MotionTick.EndTickGroup = TG_PostPhysics;
+}
+
+void UBodycamMotionSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	MotionTick.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UBodycamMotionSubsystem::Deinitialize()
+{
+	if (MotionTick.IsTickFunctionRegistered())
+	{
+		MotionTick.UnRegisterTickFunction();
+	}
+	MotionTick.Target = nullptr;
+
+	Super::Deinitialize();
+}
+
+void UBodycamMotionSubsystem::RegisterPawn(ABodycamCharacter* Pawn)
+{
+	if (!Pawn || Pawn->Hot.MotionIndex != INDEX_NONE || !Pawn->FPCameraPivot)
+	{
+		return;
+	}
+	LLM_SCOPE_BYTAG(Bodycam);
+
+	const int32 Index = Pawns.Add(Pawn);
+	Pawn->Hot.MotionIndex = Index;
+
+	if (UCharacterMovementComponent* Move = Pawn->GetCharacterMovement())
+	{
+		MotionTick.AddPrerequisite(Move, Move->PrimaryComponentTick);
+	}
+
+	const FBodycamTuning Resolved = Pawn->GetTuning();
+	TuningIndex.Add(static_cast<uint16>(FindOrAddTuning(Resolved)));
+
+	// spread unviewed pawns over frames instead of stepping them all together
+	PendingDelta.Add(FMath::Frac(Index * 0.618034f) * 0.05f);
+	StepDelta.Add(0.f);
+	NumSteps.Add(0);
+	FixedTime.Add(-1.f);
+	Significance.Add(EBodycamSignificance::Medium);
+	Detail.Add(1.f);
+
+	Velocity.Add(FVector3f::ZeroVector);
+	Forward2D.Add(FVector2f(1.f, 0.f));
+	Right2D.Add(FVector2f(0.f, 1.f));
+	MaxWalkSpeed.Add(Resolved.WalkSpeed);
+	Flags.Add(MF_Grounded | MF_WasGrounded);
+
+	BreathPhaseX.Add(0.f);
+	BreathPhaseY.Add(0.f);
+	BreathPhaseZ.Add(0.f);
+	BreathPhasePitch.Add(0.f);
+	BreathPhaseRoll.Add(0.f);
+	BreathLevel.Add(BodycamMotion::BreathIdleLevel);
+	SeedBreathPhases(Index, Pawn->GetMotionSeed());
+
+	BobTime.Add(0.f);
+	LandingOffset.Add(0.f);
+	JumpOffset.Add(0.f);
+
+	const FVector3f BaseLoc(Pawn->FPCameraPivot->GetRelativeLocation());
+	const FRotator  BaseRot = Pawn->FPCameraPivot->GetRelativeRotation();
+	PivotBase.Add(BaseLoc);
+	PivotLoc.Add(BaseLoc);
+	PivotPitch.Add(BaseRot.Pitch);
+	PivotRoll.Add(BaseRot.Roll);
+
+	const FRotator LightRot = Pawn->Flashlight ? Pawn->Flashlight->GetRelativeRotation() : FRotator::ZeroRotator;
+	FlashMoveYaw.Add(0.f);
+	FlashMovePitch.Add(0.f);
+	FlashKickPitch.Add(0.f);
+	FlashAimYaw.Add(Pawn->Hot.FlashAimYaw);
+	FlashAimPitch.Add(Pawn->Hot.FlashAimPitch);
+	LightPitch.Add(LightRot.Pitch);
+	LightYaw.Add(LightRot.Yaw);
+	LightBase.Add(Pawn->Flashlight ? FVector3f(Pawn->Flashlight->GetRelativeLocation()) : FVector3f::ZeroVector);
+
+	FOV.Add(Pawn->FPCamera ? Pawn->FPCamera->FieldOfView : Resolved.BaseFOV);
+
+	PrevPivotLoc.Add(BaseLoc);
+	PrevPivotPitch.Add(BaseRot.Pitch);
+	PrevPivotRoll.Add(BaseRot.Roll);
+	PrevLightPitch.Add(LightRot.Pitch);
+	PrevLightYaw.Add(LightRot.Yaw);
+	PrevFOV.Add(FOV.Last());
+}
+
+void UBodycamMotionSubsystem::UnregisterPawn(ABodycamCharacter* Pawn)
+{
+	if (!Pawn || !Pawns.IsValidIndex(Pawn->Hot.MotionIndex) || Pawns[Pawn->Hot.MotionIndex] != Pawn)
+	{
+		return;
+	}
+
+	const int32 Index = Pawn->Hot.MotionIndex;
+	Pawn->Hot.MotionIndex = INDEX_NONE;
+
+	if (UCharacterMovementComponent* Move = Pawn->GetCharacterMovement())
+	{
+		MotionTick.RemovePrerequisite(Move, Move->PrimaryComponentTick);
+	}
+
+	auto RemoveSwap = [Index](auto& Array) { Array.RemoveAtSwap(Index, 1, EAllowShrinking::No); };
+	RemoveSwap(Pawns);
+	RemoveSwap(TuningIndex);
+	RemoveSwap(PendingDelta);
+	RemoveSwap(StepDelta);
+	RemoveSwap(NumSteps);
+	RemoveSwap(FixedTime);
+	RemoveSwap(Significance);
+	RemoveSwap(Detail);
+	RemoveSwap(Velocity);
+	RemoveSwap(Forward2D);
+	RemoveSwap(Right2D);
+	RemoveSwap(MaxWalkSpeed);
+	RemoveSwap(Flags);
+	RemoveSwap(BreathPhaseX);
+	RemoveSwap(BreathPhaseY);
+	RemoveSwap(BreathPhaseZ);
+	RemoveSwap(BreathPhasePitch);
+	RemoveSwap(BreathPhaseRoll);
+	RemoveSwap(BreathLevel);
+	RemoveSwap(BobTime);
+	RemoveSwap(LandingOffset);
+	RemoveSwap(JumpOffset);
+	RemoveSwap(PivotBase);
+	RemoveSwap(PivotLoc);
+	RemoveSwap(PivotPitch);
+	RemoveSwap(PivotRoll);
+	RemoveSwap(FlashMoveYaw);
+	RemoveSwap(FlashMovePitch);
+	RemoveSwap(FlashKickPitch);
+	RemoveSwap(FlashAimYaw);
+	RemoveSwap(FlashAimPitch);
+	RemoveSwap(LightPitch);
+	RemoveSwap(LightYaw);
+	RemoveSwap(LightBase);
+	RemoveSwap(FOV);
+	RemoveSwap(PrevPivotLoc);
+	RemoveSwap(PrevPivotPitch);
+	RemoveSwap(PrevPivotRoll);
+	RemoveSwap(PrevLightPitch);
+	RemoveSwap(PrevLightYaw);
+	RemoveSwap(PrevFOV);
+
+	// the last pawn now lives in the freed slot
+	if (Pawns.IsValidIndex(Index))
+	{
+		Pawns[Index]->Hot.MotionIndex = Index;
+	}
+}
+
+SIZE_T UBodycamMotionSubsystem::GetAllocatedSize() const
+{
+	SIZE_T Size = 0;
+	auto Add = [&Size](const auto& Array) { Size += Array.GetAllocatedSize(); };
+	Add(Pawns);
+	Add(TuningTable);
+	Add(TuningIndex);
+	Add(PendingDelta);
+	Add(StepDelta);
+	Add(NumSteps);
+	Add(FixedTime);
+	Add(Significance);
+	Add(Detail);
+	Add(Velocity);
+	Add(Forward2D);
+	Add(Right2D);
+	Add(MaxWalkSpeed);
+	Add(Flags);
+	Add(BreathPhaseX);
+	Add(BreathPhaseY);
+	Add(BreathPhaseZ);
+	Add(BreathPhasePitch);
+	Add(BreathPhaseRoll);
+	Add(BreathLevel);
+	Add(BobTime);
+	Add(LandingOffset);
+	Add(JumpOffset);
+	Add(PivotBase);
+	Add(PivotLoc);
+	Add(PivotPitch);
+	Add(PivotRoll);
+	Add(FlashMoveYaw);
+	Add(FlashMovePitch);
+	Add(FlashKickPitch);
+	Add(FlashAimYaw);
+	Add(FlashAimPitch);
+	Add(LightPitch);
+	Add(LightYaw);
+	Add(LightBase);
+	Add(FOV);
+	Add(PrevPivotLoc);
+	Add(PrevPivotPitch);
+	Add(PrevPivotRoll);
+	Add(PrevLightPitch);
+	Add(PrevLightYaw);
+	Add(PrevFOV);
+	Add(Events);
+	return Size;
+}
+
+int32 UBodycamMotionSubsystem::FindOrAddTuning(const FBodycamTuning& NewTuning)
+{
+	// a handful of profiles per level, a linear scan is fine
+	const int32 Existing = TuningTable.IndexOfByKey(NewTuning);
+	if (Existing != INDEX_NONE)
+	{
+		return Existing;
+	}
+	check(TuningTable.Num() < MAX_uint16);
+	return TuningTable.Add(NewTuning);
+}
+
+void UBodycamMotionSubsystem::RefreshTuning(ABodycamCharacter* Pawn, const FBodycamTuning& NewTuning)
+{
+	if (Pawn && Pawns.IsValidIndex(Pawn->Hot.MotionIndex))
+	{
+		TuningIndex[Pawn->Hot.MotionIndex] = static_cast<uint16>(FindOrAddTuning(NewTuning));
+	}
+}
+
+const FBodycamTuning* UBodycamMotionSubsystem::FindTuning(const ABodycamCharacter* Pawn) const
+{
+	return Pawn && Pawns.IsValidIndex(Pawn->Hot.MotionIndex) ? &TuningTable[TuningIndex[Pawn->Hot.MotionIndex]] : nullptr;
+}
+
+EBodycamSignificance UBodycamMotionSubsystem::GetSignificance(const ABodycamCharacter* Pawn) const
+{
+	return Pawn && Pawns.IsValidIndex(Pawn->Hot.MotionIndex) ? Significance[Pawn->Hot.MotionIndex] : EBodycamSignificance::High;
+}
+
+void UBodycamMotionSubsystem::SetMotionSeed(ABodycamCharacter* Pawn, uint16 Seed)
+{
+	if (Pawn && Pawns.IsValidIndex(Pawn->Hot.MotionIndex))
+	{
+		SeedBreathPhases(Pawn->Hot.MotionIndex, Seed);
+	}
+}
+
+void UBodycamMotionSubsystem::SeedBreathPhases(int32 Index, uint16 Seed)
+{
+	// replicated seed, so every machine breathes the same for a given pawn
+	FRandomStream RS;
+	RS.Initialize(Seed);
+	BreathPhaseX[Index]     = FBodycamNoiseBank::ToPhase(RS.FRandRange(-1000.f, 1000.f));
+	BreathPhaseY[Index]     = FBodycamNoiseBank::ToPhase(RS.FRandRange(-1000.f, 1000.f));
+	BreathPhaseZ[Index]     = FBodycamNoiseBank::ToPhase(RS.FRandRange(-1000.f, 1000.f));
+	BreathPhasePitch[Index] = FBodycamNoiseBank::ToPhase(RS.FRandRange(-1000.f, 1000.f));
+	BreathPhaseRoll[Index]  = FBodycamNoiseBank::ToPhase(RS.FRandRange(-1000.f, 1000.f));
+}
+
+void UBodycamMotionSubsystem::SetViewDriven(ABodycamCharacter* Pawn, bool bViewDriven)
+{
+	if (Pawn && Pawns.IsValidIndex(Pawn->Hot.MotionIndex))
+	{
+		uint8& F = Flags[Pawn->Hot.MotionIndex];
+		F = static_cast<uint8>(bViewDriven ? (F | MF_ViewDriven) : (F & ~MF_ViewDriven));
+	}
+}
+
+bool UBodycamMotionSubsystem::GetViewPose(const ABodycamCharacter* Pawn, FBodycamViewPose& OutPose) const
+{
+	if (!Pawn || !Pawns.IsValidIndex(Pawn->Hot.MotionIndex))
+	{
+		return false;
+	}
+
+	const int32 i = Pawn->Hot.MotionIndex;
+	const FPresentedPose P = GetPresented(i);
+	OutPose.PivotOffset   = P.PivotLoc - FVector3f(Pawn->FPCameraPivot->GetRelativeLocation());
+	OutPose.Pitch         = P.PivotPitch;
+	OutPose.Roll          = P.PivotRoll;
+	OutPose.FOV           = P.FOV;
+	OutPose.LightLocation = LightBase[i];
+	OutPose.LightPitch    = P.LightPitch;
+	OutPose.LightYaw      = P.LightYaw;
+	return true;
+}
+
+bool UBodycamMotionSubsystem::GetArmsPose(const ABodycamCharacter* Pawn, FBodycamArmsPose& OutPose) const
+{
+	if (!Pawn || !Pawns.IsValidIndex(Pawn->Hot.MotionIndex))
+	{
+		return false;
+	}
+
+	const int32 i = Pawn->Hot.MotionIndex;
+	const FBodycamNoiseBank& Noise = FBodycamNoiseBank::Get();
+	const FPresentedPose P = GetPresented(i);
+	OutPose.PivotOffset    = FVector(P.PivotLoc - PivotBase[i]);
+	OutPose.PivotPitch     = P.PivotPitch;
+	OutPose.PivotRoll      = P.PivotRoll;
+	OutPose.BobPhase       = BobTime[i] * 2.f * PI;
+	OutPose.MoveAlpha      = FMath::Clamp(FVector2f(Velocity[i].X, Velocity[i].Y).Size() / FMath::Max(1.f, MaxWalkSpeed[i]), 0.f, 1.f);
+	OutPose.BreathNoise    = FVector(Noise.Sample(BreathPhaseX[i]), Noise.Sample(BreathPhaseY[i]), Noise.Sample(BreathPhaseZ[i]));
+	OutPose.BreathLevel    = BreathLevel[i];
+	OutPose.LandingOffset  = LandingOffset[i];
+	OutPose.JumpOffset     = JumpOffset[i];
+	OutPose.LightPitch     = P.LightPitch;
+	OutPose.LightYaw       = P.LightYaw;
+	OutPose.FlashKickPitch = FlashKickPitch[i];
+	OutPose.Detail         = Detail[i];
+	OutPose.bSprinting     = (Flags[i] & MF_Sprinting) != 0;
+	OutPose.bGrounded      = (Flags[i] & MF_Grounded) != 0;
+	OutPose.bViewDriven    = (Flags[i] & MF_ViewDriven) != 0;
+	return true;
+}
+
+UBodycamMotionSubsystem::FPresentedPose UBodycamMotionSubsystem::GetPresented(int32 i) const
+{
+	FPresentedPose P{ PivotLoc[i], PivotPitch[i], PivotRoll[i], LightPitch[i], LightYaw[i], FOV[i] };
+	if (FixedTime[i] >= 0.f && FixedStep > 0.f)
+	{
+		// one fixed step behind: from the state before the last step towards the last step
+		const float Alpha = FMath::Min(FixedTime[i] / FixedStep, 1.f);
+		P.PivotLoc   = FMath::Lerp(PrevPivotLoc[i],   PivotLoc[i],   Alpha);
+		P.PivotPitch = FMath::Lerp(PrevPivotPitch[i], PivotPitch[i], Alpha);
+		P.PivotRoll  = FMath::Lerp(PrevPivotRoll[i],  PivotRoll[i],  Alpha);
+		P.LightPitch = FMath::Lerp(PrevLightPitch[i], LightPitch[i], Alpha);
+		P.LightYaw   = FMath::Lerp(PrevLightYaw[i],   LightYaw[i],   Alpha);
+		P.FOV        = FMath::Lerp(PrevFOV[i],        FOV[i],        Alpha);
+	}
+	return P;
+}
+
+void UBodycamMotionSubsystem::AddTickDependent(FTickFunction& Tick)
+{
+	Tick.AddPrerequisite(this, MotionTick);
+}
+
+void UBodycamMotionSubsystem::RemoveTickDependent(FTickFunction& Tick)
+{
+	Tick.RemovePrerequisite(this, MotionTick);
+}
+
+float UBodycamMotionSubsystem::GetBreathLevel(const ABodycamCharacter* Pawn) const
+{
+	return Pawn && Pawns.IsValidIndex(Pawn->Hot.MotionIndex) ? BreathLevel[Pawn->Hot.MotionIndex] : 0.f;
+}
+
+bool UBodycamMotionSubsystem::GetRecordState(const ABodycamCharacter* Pawn, FBodycamRecordState& OutState) const
+{
+	if (!Pawn || !Pawns.IsValidIndex(Pawn->Hot.MotionIndex))
+	{
+		return false;
+	}
+
+	const int32 i = Pawn->Hot.MotionIndex;
+	OutState.BobTime        = BobTime[i];
+	OutState.BreathPhase[0] = BreathPhaseX[i];
+	OutState.BreathPhase[1] = BreathPhaseY[i];
+	OutState.BreathPhase[2] = BreathPhaseZ[i];
+	OutState.BreathPhase[3] = BreathPhasePitch[i];
+	OutState.BreathPhase[4] = BreathPhaseRoll[i];
+	OutState.LandingOffset  = LandingOffset[i];
+	OutState.JumpOffset     = JumpOffset[i];
+	OutState.FlashAimYaw    = FlashAimYaw[i];
+	OutState.FlashAimPitch  = FlashAimPitch[i];
+	OutState.FlashKickPitch = FlashKickPitch[i];
+	return true;
+}
+
+bool UBodycamMotionSubsystem::SetRecordState(ABodycamCharacter* Pawn, const FBodycamRecordState& State)
+{
+	if (!Pawn || !Pawns.IsValidIndex(Pawn->Hot.MotionIndex))
+	{
+		return false;
+	}
+
+	const int32 i = Pawn->Hot.MotionIndex;
+	BobTime[i]          = State.BobTime;
+	BreathPhaseX[i]     = FBodycamNoiseBank::ToPhase(State.BreathPhase[0]);
+	BreathPhaseY[i]     = FBodycamNoiseBank::ToPhase(State.BreathPhase[1]);
+	BreathPhaseZ[i]     = FBodycamNoiseBank::ToPhase(State.BreathPhase[2]);
+	BreathPhasePitch[i] = FBodycamNoiseBank::ToPhase(State.BreathPhase[3]);
+	BreathPhaseRoll[i]  = FBodycamNoiseBank::ToPhase(State.BreathPhase[4]);
+	LandingOffset[i]    = State.LandingOffset;
+	JumpOffset[i]       = State.JumpOffset;
+	FlashKickPitch[i]   = State.FlashKickPitch;
+
+	// fixed rate: start stepping afresh from this state
+	FixedTime[i] = -1.f;
+
+	// free-aim is also read back from the pawn in Gather
+	FlashAimYaw[i]   = Pawn->Hot.FlashAimYaw   = State.FlashAimYaw;
+	FlashAimPitch[i] = Pawn->Hot.FlashAimPitch = State.FlashAimPitch;
+	return true;
+}
+
+void UBodycamMotionSubsystem::Update(float DeltaTime)
+{
+	LLM_SCOPE_BYTAG(Bodycam);
+	BODYCAM_SCOPE(STAT_BodycamMotionUpdate, BodycamMotionUpdate);
+
+	// per-frame transform counts: cleared here, added to by Apply and then by every camera
+	// modifier (which run after us, in the camera update)
+	TRACE_COUNTER_SET(BodycamTransformsIssued, 0);
+	TRACE_COUNTER_SET(BodycamTransformsSkipped, 0);
+
+	// latency trackers allocate: follow the cvar here, before the guarded Gather
+	if (FBodycamLatencyTracker::IsEnabled() != bLatencyTracking)
+	{
+		bLatencyTracking = FBodycamLatencyTracker::IsEnabled();
+		for (ABodycamCharacter* Pawn : Pawns)
+		{
+			Pawn->RefreshLatencyTracker();
+		}
+	}
+
+	const int32 Num = Pawns.Num();
+	LastTimings = FBodycamMotionTimings();
+	Events.Reset();
+	EventsFrame = GFrameCounter;
+	if (Num == 0 || DeltaTime <= 0.f)
+	{
+		return;
+	}
+
+	FixedStep = GBodycamMotionFixedRate > 0.f ? 1.f / GBodycamMotionFixedRate : 0.f;
+	MaxSteps = 0;
+
+	const double StartTime = FPlatformTime::Seconds();
+	Gather(DeltaTime);
+	const double GatherEnd = FPlatformTime::Seconds();
+
+	if (Num >= GBodycamMotionParallelThreshold)
+	{
+		const int32 BatchSize = FMath::Max(1, GBodycamMotionBatchSize);
+		const int32 NumBatches = FMath::DivideAndRoundUp(Num, BatchSize);
+		ParallelFor(NumBatches, [this, BatchSize, Num](int32 Batch)
+		{
+			const int32 Begin = Batch * BatchSize;
+			SolveRange(Begin, FMath::Min(Begin + BatchSize, Num));
+		});
+	}
+	else
+	{
+		SolveRange(0, Num);
+	}
+	const double SolveEnd = FPlatformTime::Seconds();
+
+	Apply();
+
+	LastTimings.GatherSeconds = GatherEnd - StartTime;
+	LastTimings.SolveSeconds  = SolveEnd - GatherEnd;
+	LastTimings.ApplySeconds  = FPlatformTime::Seconds() - SolveEnd;
+}
+
+void UBodycamMotionSubsystem::Gather(float DeltaSeconds)
+{
+	BODYCAM_SCOPE(STAT_BodycamGather, BodycamGather);
+	BODYCAM_NO_ALLOC_SCOPE(MotionGather);
+
+	const FBodycamSignificance Rating = FBodycamSignificance::FromConsole();
+	FBodycamSignificance::FViews Views;
+	if (Rating.bEnabled)
+	{
+		BodycamSignificance::GetViews(*GetWorld(), Views);
+	}
+	DetailFadeRate = 1.f / FMath::Max(Rating.FadeSeconds, KINDA_SMALL_NUMBER);
+
+	int32 NumStepped = 0;
+	int32 NumDormant = 0;
+
+	for (int32 i = 0; i < Pawns.Num(); ++i)
+	{
+		ABodycamCharacter* Pawn = Pawns[i];
+
+		// one free-aim pass over all look events of the frame; the owning player's camera modifier
+		// latches the turn right before the view is built, everyone else (including pawns only a
+		// spectator or another player is watching) turns now
+		Pawn->ResolvePendingLook(TuningTable[TuningIndex[i]]);
+		const bool bViewed = (Flags[i] & MF_ViewDriven) != 0;
+		if (!bViewed || !UBodycamCameraModifier::LatchesViewOf(Pawn))
+		{
+			Pawn->LatchViewRotation(DeltaSeconds);
+		}
+
+		const EBodycamSignificance Prev = Significance[i];
+		const USkeletalMeshComponent* Mesh = Pawn->GetMesh();
+		Significance[i] = bViewed ? EBodycamSignificance::Viewed
+			: Rating.bEnabled ? Rating.Rate(Views, Pawn->GetActorLocation(), Mesh && Mesh->WasRecentlyRendered(0.2f), Prev)
+			: EBodycamSignificance::Medium;
+		NumDormant += Significance[i] == EBodycamSignificance::Dormant;
+
+		// a pawn that matters more now resumes with a normal step instead of catching up in one jump
+		if (Significance[i] < Prev)
+		{
+			PendingDelta[i] = 0.f;
+		}
+
+		// viewed and close pawns step every frame, the rest at their significance's rate (catching up in one step)
+		const float Rate = Rating.GetStepRate(Significance[i], GBodycamMotionUnviewedRate);
+		const float Interval = Rate > 0.f ? 1.f / Rate : Rate;
+		// only accumulated time is capped; a pawn stepping every frame takes the frame's delta as-is
+		PendingDelta[i] += DeltaSeconds;
+		if (Interval >= 0.f || FixedStep > 0.f)
+		{
+			PendingDelta[i] = FMath::Min(PendingDelta[i], BodycamMotion::MaxCatchUpStep);
+		}
+		const bool bStep = Interval < 0.f || (Interval > 0.f && PendingDelta[i] >= Interval);
+		if (!bStep)
+		{
+			StepDelta[i] = 0.f;
+			NumSteps[i] = 0;
+			FixedTime[i] = -1.f;
+			continue;
+		}
+		StepDelta[i] = PendingDelta[i];
+		PendingDelta[i] = 0.f;
+		NumSteps[i] = 1;
+
+		// every-frame pawns take fixed steps instead: as many as are due (bounded), none on a short frame
+		if (FixedStep > 0.f && Interval < 0.f)
+		{
+			if (FixedTime[i] < 0.f)
+			{
+				FixedTime[i] = 0.f;
+				PrevPivotLoc[i]   = PivotLoc[i];
+				PrevPivotPitch[i] = PivotPitch[i];
+				PrevPivotRoll[i]  = PivotRoll[i];
+				PrevLightPitch[i] = LightPitch[i];
+				PrevLightYaw[i]   = LightYaw[i];
+				PrevFOV[i]        = FOV[i];
+			}
+			FixedTime[i] += StepDelta[i];
+			const int32 Due = FMath::FloorToInt(FixedTime[i] / FixedStep);
+			const int32 Steps = FMath::Min(Due, FMath::Clamp(GBodycamMotionMaxSubsteps, 1, (int32)MAX_uint8));
+			FixedTime[i] = Due > Steps ? FMath::Fmod(FixedTime[i], FixedStep) : FixedTime[i] - Steps * FixedStep;
+			StepDelta[i] = FixedStep;
+			NumSteps[i] = static_cast<uint8>(Steps);
+		}
+		else
+		{
+			FixedTime[i] = -1.f;
+		}
+		NumStepped += NumSteps[i] > 0;
+		MaxSteps = FMath::Max(MaxSteps, (int32)NumSteps[i]);
+
+		// one snapshot of the movement state, shared by the POV, sway and FOV passes
+		const UCharacterMovementComponent* Move = Pawn->GetCharacterMovement();
+
+		const FVector Fwd   = Pawn->GetActorForwardVector();
+		const FVector Right = Pawn->GetActorRightVector();
+		Velocity[i]  = FVector3f(Pawn->GetVelocity());
+		Forward2D[i] = BodycamMotion::SafeNormal(FVector2f(Fwd.X, Fwd.Y));
+		Right2D[i]   = BodycamMotion::SafeNormal(FVector2f(Right.X, Right.Y));
+
+		uint8 F = static_cast<uint8>(Flags[i] & (MF_WasGrounded | MF_ViewDriven));
+		if (Move)
+		{
+			MaxWalkSpeed[i] = Move->MaxWalkSpeed;
+			if (Move->IsMovingOnGround()) F |= MF_Grounded;
+			if (Move->IsCrouching())      F |= MF_Crouching;
+		}
+		else
+		{
+			MaxWalkSpeed[i] = 600.f;
+			F |= MF_Grounded;
+		}
+		if (Pawn->Hot.bIsSprinting) F |= MF_Sprinting;
+		Flags[i] = F;
+
+		FlashAimYaw[i]   = Pawn->Hot.FlashAimYaw;
+		FlashAimPitch[i] = Pawn->Hot.FlashAimPitch;
+	}
+
+	INC_DWORD_STAT_BY(STAT_BodycamPawnsStepped, NumStepped);
+	INC_DWORD_STAT_BY(STAT_BodycamPawnsDormant, NumDormant);
+}
+
+void UBodycamMotionSubsystem::SolveRange(int32 Begin, int32 End)
+{
+	LLM_SCOPE_BYTAG(Bodycam);
+	BODYCAM_NO_ALLOC_SCOPE(MotionSolve);
+
+	// one pass per effect so each only streams the arrays it needs; a batch takes all its steps
+	for (int32 Step = 0; Step < MaxSteps; ++Step)
+	{
+		SolvePOV(Begin, End, Step);
+		SolveFlashlight(Begin, End, Step);
+		SolveFOV(Begin, End, Step);
+	}
+}
+
+void UBodycamMotionSubsystem::SolvePOV(int32 Begin, int32 End, int32 Step)
+{
+	BODYCAM_SCOPE(STAT_BodycamPOV, BodycamPOV);
+
+	const FBodycamNoiseBank& Noise = FBodycamNoiseBank::Get();
+
+	for (int32 i = Begin; i < End; ++i)
+	{
+		if (Step >= NumSteps[i])
+		{
+			continue;
+		}
+		const float DeltaSeconds = StepDelta[i];
+		const FBodycamTuning& T = TuningTable[TuningIndex[i]];
+		const FVector3f V = Velocity[i];
+		const uint8 F = Flags[i];
+		const bool bGrounded    = (F & MF_Grounded) != 0;
+		const bool bWasGrounded = (F & MF_WasGrounded) != 0;
+		const bool bTakeoff     = bWasGrounded && !bGrounded;
+		const bool bLanded      = !bWasGrounded && bGrounded;
+
+		const FVector2f V2(V.X, V.Y);
+		const float Speed2D = V2.Size();
+		const float MaxSpd  = FMath::Max(1.f, MaxWalkSpeed[i]);
+		const float PrevBobTime = BobTime[i];
+
+		// breathing / bob / roll fade out as a pawn loses significance and back in as it regains it
+		Detail[i] = FMath::FInterpConstantTo(Detail[i], FBodycamSignificance::HasDetail(Significance[i]) ? 1.f : 0.f, DeltaSeconds, DetailFadeRate);
+
+		FBodycamMotionContext Ctx
+		{
+			.T = T,
+			.Noise = Noise,
+			.DeltaSeconds = DeltaSeconds,
+			.Velocity2D = V2,
+			.Right2D = Right2D[i],
+			.Speed2D = Speed2D,
+			.MaxSpeed = MaxSpd,
+			.MoveAlpha = FMath::Clamp(Speed2D / MaxSpd, 0.f, 1.f),
+			.Detail = Detail[i],
+			.bGrounded = bGrounded,
+			.bCrouching = (F & MF_Crouching) != 0,
+			.bTakeoff = bTakeoff,
+			.bLanded = bLanded,
+			.BreathPhase = { &BreathPhaseX[i], &BreathPhaseY[i], &BreathPhaseZ[i], &BreathPhasePitch[i], &BreathPhaseRoll[i] },
+			.BobTime = BobTime[i],
+			.LandingOffset = LandingOffset[i],
+			.JumpOffset = JumpOffset[i],
+		};
+
+		// the channel set is picked per profile; each case is one inlined stack. Faded out pawns
+		// only keep the landing / jump kicks
+		FBodycamMotionPose Pose;
+		if (Detail[i] <= 0.f)
+		{
+			FBodycamFarMotionStack::Evaluate(Ctx, Pose);
+		}
+		else switch (T.MotionStack)
+		{
+		case EBodycamMotionStack::NPC:       FBodycamNPCMotionStack::Evaluate(Ctx, Pose); break;
+		case EBodycamMotionStack::Cinematic: FBodycamCinematicMotionStack::Evaluate(Ctx, Pose); break;
+		default:                             FBodycamPlayerMotionStack::Evaluate(Ctx, Pose); break;
+		}
+
+		// loudness for the breathing audio: the breathing noise, heavier while sprinting
+		const float TargetBreath = FMath::Lerp(BodycamMotion::BreathIdleLevel, 1.f, (F & MF_Sprinting) ? 1.f : 0.4f * Ctx.MoveAlpha) * (0.8f + 0.2f * Ctx.BreathNoiseZ);
+		BreathLevel[i] = FMath::FInterpTo(BreathLevel[i], TargetBreath, DeltaSeconds, BodycamMotion::BreathLevelInterpSpeed);
+
+		uint8 NewF = static_cast<uint8>(bGrounded ? (F | MF_WasGrounded) : (F & ~MF_WasGrounded));
+		if (bTakeoff) NewF |= MF_Takeoff;
+		if (bLanded)  NewF |= MF_Landed;
+		if (FBodycamFootfall::Crossed(PrevBobTime, BobTime[i])) NewF |= MF_Footstep;
+		Flags[i] = NewF;
+
+		if (Step == NumSteps[i] - 1)
+		{
+			PrevPivotLoc[i]   = PivotLoc[i];
+			PrevPivotPitch[i] = PivotPitch[i];
+			PrevPivotRoll[i]  = PivotRoll[i];
+		}
+		PivotLoc[i]   = BodycamMotion::VInterpTo(PivotLoc[i], PivotBase[i] + Pose.Offset, DeltaSeconds, 10.f);
+		PivotRoll[i]  = FMath::FInterpTo(PivotRoll[i],  Pose.Roll,  DeltaSeconds, T.RollInterpSpeed);
+		PivotPitch[i] = FMath::FInterpTo(PivotPitch[i], Pose.Pitch, DeltaSeconds, 6.f);
+	}
+}
+
+void UBodycamMotionSubsystem::SolveFlashlight(int32 Begin, int32 End, int32 Step)
+{
+	BODYCAM_SCOPE(STAT_BodycamFlashlightSway, BodycamFlashlightSway);
+
+	for (int32 i = Begin; i < End; ++i)
+	{
+		if (Step >= NumSteps[i])
+		{
+			continue;
+		}
+		const float DeltaSeconds = StepDelta[i];
+		const FBodycamTuning& T = TuningTable[TuningIndex[i]];
+		const uint8 F = Flags[i];
+
+		const FVector2f V2(Velocity[i].X, Velocity[i].Y);
+		const float MoveAlpha = FMath::Clamp(V2.Size() / FMath::Max(1.f, MaxWalkSpeed[i]), 0.f, 1.f);
+		const float Phase = BobTime[i] * 2.f * PI;
+
+		// ---------- Flashlight: movement sway & jump/land impulses ----------
+		const FVector2f vN = V2.IsNearlyZero() ? FVector2f::ZeroVector : BodycamMotion::SafeNormal(V2);
+		const float fwdNorm    = FVector2f::DotProduct(vN, Forward2D[i]);
+		const float strafeNorm = FVector2f::DotProduct(vN, Right2D[i]);
+		const float sprintScale = (F & MF_Sprinting) ? T.FlashSprintSwayScale : 1.f;
+
+		// sway settles to rest (and stays there) as the pawn loses significance
+		const float targetMoveYaw   = ((strafeNorm * T.FlashMoveYawByStrafe  * MoveAlpha * sprintScale)
+									+ (FMath::Sin(Phase * 0.5f) * T.FlashBobYaw   * MoveAlpha)) * Detail[i];
+		const float targetMovePitch = ((-fwdNorm   * T.FlashMovePitchBySpeed * MoveAlpha * sprintScale)
+									+ (FMath::Sin(Phase)        * T.FlashBobPitch * MoveAlpha)) * Detail[i];
+
+		FlashMoveYaw[i]   = FMath::FInterpTo(FlashMoveYaw[i],   targetMoveYaw,   DeltaSeconds, T.FlashMoveInterp);
+		FlashMovePitch[i] = FMath::FInterpTo(FlashMovePitch[i], targetMovePitch, DeltaSeconds, T.FlashMoveInterp);
+
+		// the kicks land once, on the first of the frame's steps
+		if (Step == 0)
+		{
+			if (F & MF_Takeoff) FlashKickPitch[i] += T.FlashJumpPitchKick;
+			if (F & MF_Landed)  FlashKickPitch[i] += T.FlashLandPitchKick;
+		}
+		FlashKickPitch[i] = FMath::FInterpTo(FlashKickPitch[i], 0.f, DeltaSeconds, T.FlashKickReturnSpeed);
+
+		// free-aim recenters when there is no input
+		FlashAimYaw[i]   = FMath::FInterpTo(FlashAimYaw[i],   0.f, DeltaSeconds, T.FlashAimReturnSpeed);
+		FlashAimPitch[i] = FMath::FInterpTo(FlashAimPitch[i], 0.f, DeltaSeconds, T.FlashAimReturnSpeed);
+
+		const float PitchToApply = FlashAimPitch[i] * T.GetFlashAimPitchSign() + FlashMovePitch[i] + FlashKickPitch[i];
+		const float YawToApply   = FlashAimYaw[i]   * T.GetFlashAimYawSign() + FlashMoveYaw[i];
+		if (Step == NumSteps[i] - 1)
+		{
+			PrevLightPitch[i] = LightPitch[i];
+			PrevLightYaw[i]   = LightYaw[i];
+		}
+		LightPitch[i] = FMath::FInterpTo(LightPitch[i], -PitchToApply, DeltaSeconds, T.FlashAimSmoothing);
+		LightYaw[i]   = FMath::FInterpTo(LightYaw[i],   YawToApply,    DeltaSeconds, T.FlashAimSmoothing);
+	}
+}
+
+void UBodycamMotionSubsystem::SolveFOV(int32 Begin, int32 End, int32 Step)
+{
+	BODYCAM_SCOPE(STAT_BodycamFOV, BodycamFOV);
+
+	for (int32 i = Begin; i < End; ++i)
+	{
+		if (Step >= NumSteps[i])
+		{
+			continue;
+		}
+		const float DeltaSeconds = StepDelta[i];
+		const FBodycamTuning& T = TuningTable[TuningIndex[i]];
+		const float Speed2D = FVector2f(Velocity[i].X, Velocity[i].Y).Size();
+
+		// ---------- Speed-based FOV (sensor feel) ----------
+		const float FOVAlpha  = FMath::Clamp((Speed2D - T.WalkSpeed) / FMath::Max(1.f, (T.SprintSpeed - T.WalkSpeed)), 0.f, 1.f);
+		const float TargetFOV = FMath::Lerp(T.BaseFOV, T.SprintFOV, FOVAlpha);
+		if (Step == NumSteps[i] - 1)
+		{
+			PrevFOV[i] = FOV[i];
+		}
+		FOV[i] = FMath::FInterpTo(FOV[i], TargetFOV, DeltaSeconds, T.FOVInterpSpeed);
+	}
+}
+
+void UBodycamMotionSubsystem::Apply()
+{
+	BODYCAM_SCOPE(STAT_BodycamApply, BodycamApply);
+	BODYCAM_NO_ALLOC_SCOPE(MotionApply);
+
+	int32 NumIssued = 0;
+	int32 NumSkipped = 0;
+	int32 NumActiveLights = 0;
+
+	for (int32 i = 0; i < Pawns.Num(); ++i)
+	{
+		ABodycamCharacter* Pawn = Pawns[i];
+		const bool bStepped = NumSteps[i] > 0;
+
+		// pawns that did not step keep the free-aim they resolved this frame
+		if (bStepped)
+		{
+			Pawn->Hot.FlashAimYaw   = FlashAimYaw[i];
+			Pawn->Hot.FlashAimPitch = FlashAimPitch[i];
+		}
+		if (Pawn->IsLocallyControlled())
+		{
+			Pawn->SendNetState();
+		}
+
+		if (Pawn->Flashlight && Pawn->Flashlight->IsVisible())
+		{
+			++NumActiveLights;
+		}
+
+		// fixed rate pawns move on screen every frame, stepped or not
+		if (!bStepped && FixedTime[i] < 0.f)
+		{
+			continue;
+		}
+
+		FBodycamLatencyTracker* Latency = Pawn->GetLatencyTracker();
+		if (Latency && bStepped)
+		{
+			// the light chases its target at FlashAimSmoothing, the free-aim returns at FlashAimReturnSpeed
+			const FBodycamTuning& T = TuningTable[TuningIndex[i]];
+			const float TargetPitch = -(FlashAimPitch[i] * T.GetFlashAimPitchSign() + FlashMovePitch[i] + FlashKickPitch[i]);
+			const float TargetYaw   = FlashAimYaw[i] * T.GetFlashAimYawSign() + FlashMoveYaw[i];
+			const float LightError  = FMath::Max(FMath::Abs(LightPitch[i] - TargetPitch), FMath::Abs(LightYaw[i] - TargetYaw));
+			Latency->UpdateConvergence(LightError, FMath::Max(FMath::Abs(FlashAimYaw[i]), FMath::Abs(FlashAimPitch[i])), StepDelta[i] * NumSteps[i]);
+		}
+
+		if (bStepped && (Flags[i] & (MF_Footstep | MF_Landed)))
+		{
+			FBodycamMotionEvent& Event = Events.AddDefaulted_GetRef();
+			Event.Pawn = Pawn;
+			Event.bLanding = (Flags[i] & MF_Landed) != 0;
+			Event.Strength = Event.bLanding ? 1.f
+				: FVector2f(Velocity[i].X, Velocity[i].Y).Size() / FMath::Max(1.f, MaxWalkSpeed[i]) * ((Flags[i] & MF_Sprinting) ? 1.25f : 1.f);
+		}
+
+		// view-driven pawns get their pose from the camera modifier instead
+		if (Flags[i] & MF_ViewDriven)
+		{
+			continue;
+		}
+
+		// ONE transform update for the pivot (location + rotation together)
+		const FPresentedPose P = GetPresented(i);
+		Pawn->FPCameraPivot->SetRelativeLocationAndRotation(FVector(P.PivotLoc), FRotator(P.PivotPitch, 0.f, P.PivotRoll));
+		++NumIssued;
+
+		if (Pawn->Flashlight)
+		{
+			const FRotator LightRot(P.LightPitch, P.LightYaw, 0.f);
+			if (!Pawn->Flashlight->GetRelativeRotation().Equals(LightRot, GBodycamLightUpdateThreshold))
+			{
+				Pawn->Flashlight->SetRelativeRotation(LightRot);
+				++NumIssued;
+			}
+			else
+			{
+				++NumSkipped;
+			}
+			if (Latency)
+			{
+				Latency->Stamp(EBodycamLatencyStage::Flashlight, FPlatformTime::Seconds());
+			}
+		}
+		if (Pawn->FPCamera)
+		{
+			Pawn->FPCamera->SetFieldOfView(P.FOV);
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_BodycamTransformsIssued, NumIssued);
+	INC_DWORD_STAT_BY(STAT_BodycamTransformsSkipped, NumSkipped);
+	INC_DWORD_STAT_BY(STAT_BodycamActiveLights, NumActiveLights);
+	TRACE_COUNTER_ADD(BodycamTransformsIssued, NumIssued);
+	TRACE_COUNTER_ADD(BodycamTransformsSkipped, NumSkipped);
+	TRACE_COUNTER_SET(BodycamActiveLights, NumActiveLights);
+}
+
+float UBodycamMotionSubsystem::GetLightUpdateThreshold()
+{
+	return GBodycamLightUpdateThreshold;
+}
+
+bool UBodycamMotionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
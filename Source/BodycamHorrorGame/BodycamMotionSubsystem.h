@@ -0,0 +1,283 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "BodycamProfile.h"
+#include "BodycamSignificance.h"
+#include "BodycamMotionSubsystem.generated.h"
+
+class ABodycamCharacter;
+class UBodycamMotionSubsystem;
+struct FBodycamRecordState;
+
+/** Runs the bodycam update in TG_PostPhysics, after every registered pawn's CharacterMovement. */
+USTRUCT()
+struct FBodycamMotionTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UBodycamMotionSubsystem* Target = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FBodycamMotionTickFunction> : public TStructOpsTypeTraitsBase2<FBodycamMotionTickFunction>
+{
+	enum { WithCopy = false };
+};
+
+/** Wall-clock cost of the last subsystem update, by phase. */
+struct FBodycamMotionTimings
+{
+	double GatherSeconds = 0.0;
+	double SolveSeconds  = 0.0;
+	double ApplySeconds  = 0.0;
+
+	double GetTotalSeconds() const { return GatherSeconds + SolveSeconds + ApplySeconds; }
+};
+
+/** A footfall or landing from the last update (UBodycamAudioSubsystem plays them). */
+struct FBodycamMotionEvent
+{
+	ABodycamCharacter* Pawn = nullptr;
+	float Strength = 0.f; // footsteps: speed relative to walk (x1.25 sprinting), landings: 1
+	bool bLanding = false;
+};
+
+/** Final-view pose of one pawn, applied late by UBodycamCameraModifier. */
+struct FBodycamViewPose
+{
+	FVector3f PivotOffset = FVector3f::ZeroVector; // capsule space, relative to where the pivot component sits
+	float Pitch = 0.f;
+	float Roll  = 0.f;
+	float FOV   = 90.f;
+
+	FVector3f LightLocation = FVector3f::ZeroVector; // relative to the view
+	float LightPitch = 0.f;
+	float LightYaw   = 0.f;
+};
+
+/**
+ * What first-person arms need to move with the camera (UBodycamArmsAnimInstance), read on the game
+ * thread so the anim update can run on a worker. Offsets in cm, angles in deg.
+ */
+USTRUCT(BlueprintType)
+struct FBodycamArmsPose
+{
+	GENERATED_BODY()
+
+	// the camera pivot's motion this frame (bob + breathing + landing / jump), relative to its rest pose
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") FVector PivotOffset = FVector::ZeroVector;
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") float PivotPitch = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") float PivotRoll = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") float BobPhase = 0.f;     // rad, one footfall per PI
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") float MoveAlpha = 0.f;    // 0..1 of max walk speed
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") FVector BreathNoise = FVector::ZeroVector; // -1..1 per axis
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") float BreathLevel = 0.f;  // 0..1 idle to heavy
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") float LandingOffset = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") float JumpOffset = 0.f;
+
+	// flashlight relative to the view: the same values the beam is drawn with
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") float LightPitch = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") float LightYaw = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") float FlashKickPitch = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") float Detail = 1.f;       // fades with significance
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") bool bSprinting = false;
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") bool bGrounded = true;
+
+	// the pivot is not moved: UBodycamCameraModifier adds PivotOffset / Pitch / Roll to the final view instead
+	UPROPERTY(BlueprintReadOnly, Category="Bodycam") bool bViewDriven = false;
+};
+
+/**
+ * Bodycam motion for every ABodycamCharacter in the world, kept in struct-of-arrays form.
+ * Each frame: gather movement inputs on the game thread, solve bob/breath/landing/sway for
+ * all pawns in one pass (ParallelFor when the count is large), then write the transforms back.
+ *
+ * Updates from its own tick function in TG_PostPhysics with every pawn's movement component as
+ * a prerequisite, so the snapshot always sees this frame's movement. Pawns nobody views through
+ * are rated by FBodycamSignificance: close ones step every frame, mid range ones at
+ * bodycam.Motion.UnviewedRate, far ones slowly without breathing / bob / sway, and far
+ * off-screen ones not at all.
+ *
+ * With bodycam.Motion.FixedRate set, pawns that step every frame step at that fixed rate instead
+ * (up to bodycam.Motion.MaxSubsteps a frame, the rest of a hitch is dropped) and the pivot,
+ * flashlight and FOV are shown interpolated between the last two steps, one step behind. The
+ * motion then looks the same at any frame rate and replays bit for bit; the steps run in the
+ * batched solve, so above the parallel threshold they are taken on worker threads.
+ */
+UCLASS()
+class BODYCAMHORRORGAME_API UBodycamMotionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void RegisterPawn(ABodycamCharacter* Pawn);
+	void UnregisterPawn(ABodycamCharacter* Pawn);
+
+	int32 GetNumPawns() const { return Pawns.Num(); }
+	TConstArrayView<TObjectPtr<ABodycamCharacter>> GetPawns() const { return Pawns; }
+
+	const FBodycamMotionTimings& GetLastTimings() const { return LastTimings; }
+
+	/** Heap held by the per-pawn state arrays (slack included), the tuning table and the event list. */
+	SIZE_T GetAllocatedSize() const;
+
+	/**
+	 * A view-driven pawn is rendered through UBodycamCameraModifier: we stop writing its pivot,
+	 * camera FOV and flashlight, and the modifier applies the pose to the final view instead.
+	 */
+	void SetViewDriven(ABodycamCharacter* Pawn, bool bViewDriven);
+
+	/** Re-resolve a registered pawn's tuning (profile swapped or overrides changed). */
+	void RefreshTuning(ABodycamCharacter* Pawn, const FBodycamTuning& NewTuning);
+
+	/** Shared tuning a registered pawn solves with, or null. */
+	const FBodycamTuning* FindTuning(const ABodycamCharacter* Pawn) const;
+
+	/** Re-seed the breathing phases (the seed replicates and may arrive after registration). */
+	void SetMotionSeed(ABodycamCharacter* Pawn, uint16 Seed);
+	bool GetViewPose(const ABodycamCharacter* Pawn, FBodycamViewPose& OutPose) const;
+	bool GetArmsPose(const ABodycamCharacter* Pawn, FBodycamArmsPose& OutPose) const;
+
+	/** Runs a tick (an arms mesh reading GetArmsPose) after this frame's update, so it never lags the camera. */
+	void AddTickDependent(FTickFunction& Tick);
+	void RemoveTickDependent(FTickFunction& Tick);
+
+	/** Footfalls and landings of the last update, which ran on frame GetFrameEventsFrame(). */
+	TConstArrayView<FBodycamMotionEvent> GetFrameEvents() const { return Events; }
+	uint64 GetFrameEventsFrame() const { return EventsFrame; }
+
+	/** Last rating of a registered pawn (High if it is not registered). */
+	EBodycamSignificance GetSignificance(const ABodycamCharacter* Pawn) const;
+
+	/** 0..1 breathing loudness: idle to heavy, following the breathing noise and sprint. */
+	float GetBreathLevel(const ABodycamCharacter* Pawn) const;
+
+	/** Runtime state for record / replay (UBodycamReplaySubsystem). */
+	bool GetRecordState(const ABodycamCharacter* Pawn, FBodycamRecordState& OutState) const;
+	bool SetRecordState(ABodycamCharacter* Pawn, const FBodycamRecordState& State);
+
+	/** Flashlight updates smaller than this (deg / cm) are skipped (bodycam.Motion.LightUpdateThreshold). */
+	static float GetLightUpdateThreshold();
+
+	/** One bodycam frame for every pawn (called by the tick function). */
+	void Update(float DeltaTime);
+
+	// UWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	enum EMotionFlags : uint8
+	{
+		MF_Grounded    = 1 << 0,
+		MF_Crouching   = 1 << 1,
+		MF_Sprinting   = 1 << 2,
+		MF_WasGrounded = 1 << 3,
+		MF_ViewDriven  = 1 << 4,
+		MF_Takeoff     = 1 << 5, // this frame only
+		MF_Landed      = 1 << 6, // this frame only
+		MF_Footstep    = 1 << 7, // this frame only
+	};
+
+	/** What is shown this frame: the last step, or between the last two with the fixed rate. */
+	struct FPresentedPose
+	{
+		FVector3f PivotLoc;
+		float PivotPitch;
+		float PivotRoll;
+		float LightPitch;
+		float LightYaw;
+		float FOV;
+	};
+
+	int32 FindOrAddTuning(const FBodycamTuning& NewTuning);
+	void SeedBreathPhases(int32 Index, uint16 Seed);
+	void Gather(float DeltaSeconds);
+	void SolveRange(int32 Begin, int32 End);
+	void SolvePOV(int32 Begin, int32 End, int32 Step);
+	void SolveFlashlight(int32 Begin, int32 End, int32 Step);
+	void SolveFOV(int32 Begin, int32 End, int32 Step);
+	void Apply();
+	FPresentedPose GetPresented(int32 i) const;
+
+	FBodycamMotionTimings LastTimings;
+	FBodycamMotionTickFunction MotionTick;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ABodycamCharacter>> Pawns;
+
+	// distinct tunings (pawns sharing a profile share an entry; never shrinks) and one index per pawn
+	TArray<FBodycamTuning> TuningTable;
+	TArray<uint16> TuningIndex;
+
+	// time since the pawn last stepped, and the step taken this frame (0 = not stepped) NumSteps times
+	TArray<float> PendingDelta;
+	TArray<float> StepDelta;
+	TArray<uint8> NumSteps;
+	int32 MaxSteps = 0; // most steps any pawn takes this update
+
+	// fixed rate: time past the last fixed step (s), < 0 while the pawn steps with the frame
+	TArray<float> FixedTime;
+	float FixedStep = 0.f; // s, this update (0 = off)
+
+	// significance rating, and the 0..1 weight of breathing / bob / sway fading towards it
+	TArray<EBodycamSignificance> Significance;
+	TArray<float> Detail;
+	float DetailFadeRate = 1.f; // per second, for this update
+
+	// inputs, sampled in Gather on the frames a pawn steps
+	TArray<FVector3f> Velocity;
+	TArray<FVector2f> Forward2D;
+	TArray<FVector2f> Right2D;
+	TArray<float>     MaxWalkSpeed;
+	TArray<uint8>     Flags;
+
+	// breathing: per-channel phase into FBodycamNoiseBank
+	TArray<float> BreathPhaseX, BreathPhaseY, BreathPhaseZ, BreathPhasePitch, BreathPhaseRoll;
+	TArray<float> BreathLevel;
+
+	// bob / landing
+	TArray<float> BobTime;
+	TArray<float> LandingOffset;
+	TArray<float> JumpOffset;
+
+	// camera pivot (relative to the capsule)
+	TArray<FVector3f> PivotBase;
+	TArray<FVector3f> PivotLoc;
+	TArray<float>     PivotPitch;
+	TArray<float>     PivotRoll;
+
+	// flashlight
+	TArray<float> FlashMoveYaw, FlashMovePitch, FlashKickPitch;
+	TArray<float> FlashAimYaw, FlashAimPitch;
+	TArray<float> LightPitch, LightYaw;
+	TArray<FVector3f> LightBase;
+
+	TArray<float> FOV;
+
+	// shown state before the last step, the other end of the fixed rate interpolation
+	TArray<FVector3f> PrevPivotLoc;
+	TArray<float> PrevPivotPitch, PrevPivotRoll;
+	TArray<float> PrevLightPitch, PrevLightYaw;
+	TArray<float> PrevFOV;
+
+	TArray<FBodycamMotionEvent> Events;
+	uint64 EventsFrame = 0;
+
+	// bodycam.Latency.Track as of the last update; pawns' trackers are refreshed when it flips
+	bool bLatencyTracking = false;
+};
@@ -0,0 +1,78 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamNetState.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamCharacter.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include <atomic>
+
+namespace BodycamNet
+{
+	static constexpr int64 StateBits = 18;
+
+	// NetSerialize runs on whichever thread replicates the actor
+	static std::atomic<int64> SentBits = 0;
+	static double LastReportTime = 0.0;
+}
+
+static FAutoConsoleCommandWithWorld CmdBodycamNetReport(
+	TEXT("bodycam.Net.Report"),
+	TEXT("Log bodycam state bytes/s per pawn and the net driver's total outgoing bytes/s per pawn, since the last report."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		int32 NumPawns = 0;
+		for (TActorIterator<ABodycamCharacter> It(World); It; ++It)
+		{
+			++NumPawns;
+		}
+
+		const double Now = FPlatformTime::Seconds();
+		const double Elapsed = BodycamNet::LastReportTime > 0.0 ? Now - BodycamNet::LastReportTime : 0.0;
+		BodycamNet::LastReportTime = Now;
+
+		const double StateBytes = FBodycamNetState::ConsumeSentBits() / 8.0;
+		const UNetDriver* Driver = World->GetNetDriver();
+		const double PerPawn = FMath::Max(1, NumPawns);
+		UE_LOG(LogBodycam, Display, TEXT("bodycam net: %d pawns, flashlight state %.1f B/s per pawn, net driver out %.1f B/s per pawn"),
+			NumPawns,
+			Elapsed > 0.0 ? StateBytes / Elapsed / PerPawn : 0.0,
+			Driver ? Driver->OutBytesPerSecond / PerPawn : 0.0);
+	}));
+
+void FBodycamNetState::SetAim(float YawDeg, float PitchDeg)
+{
+	AimYaw   = (int8)FMath::Clamp(FMath::RoundToInt(YawDeg   * AimStepsPerDeg), -128, 127);
+	AimPitch = (int8)FMath::Clamp(FMath::RoundToInt(PitchDeg * AimStepsPerDeg), -128, 127);
+}
+
+bool FBodycamNetState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 Bits = (bFlashlightOn ? 1 : 0) | (bSprinting ? 2 : 0);
+	Ar.SerializeBits(&Bits, 2);
+	bFlashlightOn = (Bits & 1) != 0;
+	bSprinting    = (Bits & 2) != 0;
+
+	Ar << AimYaw;
+	Ar << AimPitch;
+
+	if (Ar.IsSaving())
+	{
+		BodycamNet::SentBits.fetch_add(BodycamNet::StateBits, std::memory_order_relaxed);
+	}
+	bOutSuccess = true;
+	return true;
+}
+
+int64 FBodycamNetState::ConsumeSentBits()
+{
+	return BodycamNet::SentBits.exchange(0, std::memory_order_relaxed);
+}
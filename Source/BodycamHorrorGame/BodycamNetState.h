@@ -0,0 +1,51 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BodycamNetState.generated.h"
+
+/**
+ * Replicated bodycam state of a pawn: flashlight on/off, sprint and free-aim, 18 bits on the wire.
+ * Sprint feeds the proxy's breath level and flashlight sway, which movement alone cannot tell.
+ * Aim is quantized to 1/8 degree in [-16, 15.875]; FBodycamTuning keeps the free-aim limits
+ * inside that (FlashAimLimit), so the clamp in SetAim never bites.
+ * Everything else (bob, breathing, sway) is rebuilt on each machine from replicated movement.
+ */
+USTRUCT()
+struct BODYCAMHORRORGAME_API FBodycamNetState
+{
+	GENERATED_BODY()
+
+	static constexpr float AimStepsPerDeg = 8.f;
+
+	UPROPERTY()
+	bool bFlashlightOn = false;
+
+	UPROPERTY()
+	bool bSprinting = false;
+
+	UPROPERTY()
+	int8 AimYaw = 0;
+
+	UPROPERTY()
+	int8 AimPitch = 0;
+
+	void SetAim(float YawDeg, float PitchDeg);
+	float GetAimYaw() const   { return AimYaw   / AimStepsPerDeg; }
+	float GetAimPitch() const { return AimPitch / AimStepsPerDeg; }
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	/** Bits written by NetSerialize since the last call (bodycam.Net.Report). */
+	static int64 ConsumeSentBits();
+};
+
+template<>
+struct TStructOpsTypeTraits<FBodycamNetState> : public TStructOpsTypeTraitsBase2<FBodycamNetState>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
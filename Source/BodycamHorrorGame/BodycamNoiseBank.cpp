@@ -0,0 +1,88 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamNoiseBank.h"
+#include "BodycamHorrorGame.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarBodycamNoiseSamplesPerUnit(
+	TEXT("bodycam.NoiseBank.SamplesPerUnit"),
+	16,
+	TEXT("Breathing noise table samples per noise unit (rounded to a power of two, 1..256).\n")
+	TEXT("The table covers 256 units, so 16 = 4096 entries."),
+	ECVF_ReadOnly);
+
+static TAutoConsoleVariable<bool> CVarBodycamNoiseQuantize(
+	TEXT("bodycam.NoiseBank.Quantize"),
+	true,
+	TEXT("Store the breathing noise table as 16-bit values instead of floats."),
+	ECVF_ReadOnly);
+
+const FBodycamNoiseBank& FBodycamNoiseBank::Get()
+{
+	static const FBodycamNoiseBank Bank(CVarBodycamNoiseSamplesPerUnit.GetValueOnAnyThread(), CVarBodycamNoiseQuantize.GetValueOnAnyThread());
+	return Bank;
+}
+
+float FBodycamNoiseBank::ToPhase(float Value)
+{
+	const float Phase = FMath::Fmod(Value, Period);
+	return Phase < 0.f ? Phase + Period : Phase;
+}
+
+FBodycamNoiseBank::FBodycamNoiseBank(int32 InSamplesPerUnit, bool bInQuantize)
+{
+	const int32 PerUnit = FMath::RoundUpToPowerOfTwo(FMath::Clamp(InSamplesPerUnit, 1, 256));
+	const int32 Length  = PerUnit * (int32)Period;
+
+	SamplesPerUnit = (float)PerUnit;
+	Mask = Length - 1;
+	bQuantized = bInQuantize;
+
+	if (bQuantized)
+	{
+		Quantized.SetNumUninitialized(Length);
+		for (int32 i = 0; i < Length; ++i)
+		{
+			const float N = FMath::PerlinNoise1D((float)i / SamplesPerUnit);
+			Quantized[i] = (int16)FMath::RoundToInt(FMath::Clamp(N, -1.f, 1.f) * 32767.f);
+		}
+	}
+	else
+	{
+		Table.SetNumUninitialized(Length);
+		for (int32 i = 0; i < Length; ++i)
+		{
+			Table[i] = FMath::PerlinNoise1D((float)i / SamplesPerUnit);
+		}
+	}
+
+	MaxDeviation = MeasureMaxDeviation();
+
+	UE_LOG(LogBodycam, Log, TEXT("Breathing noise bank: %d entries (%s, %llu bytes), max deviation from PerlinNoise1D %.5f"),
+		Length, bQuantized ? TEXT("int16") : TEXT("float"), (uint64)GetAllocatedSize(), MaxDeviation);
+
+	if (!IsWithinTolerance())
+	{
+		UE_LOG(LogBodycam, Error, TEXT("Breathing noise bank deviates %.5f from PerlinNoise1D (tolerance %.5f); raise bodycam.NoiseBank.SamplesPerUnit"),
+			MaxDeviation, MaxDeviationTolerance);
+	}
+}
+
+float FBodycamNoiseBank::MeasureMaxDeviation() const
+{
+	// check each entry (quantization error) and a few points between entries (lerp error)
+	static constexpr int32 StepsBetween = 4;
+	const int32 Length = Mask + 1;
+
+	float MaxErr = 0.f;
+	for (int32 i = 0; i < Length; ++i)
+	{
+		for (int32 s = 0; s < StepsBetween; ++s)
+		{
+			const float Phase = ((float)i + (float)s / StepsBetween) / SamplesPerUnit;
+			MaxErr = FMath::Max(MaxErr, FMath::Abs(Sample(Phase) - FMath::PerlinNoise1D(Phase)));
+		}
+	}
+	return MaxErr;
+}
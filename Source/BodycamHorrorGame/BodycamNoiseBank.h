@@ -0,0 +1,73 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Shared breathing-noise table. FMath::PerlinNoise1D repeats every 256 units, so the table
+ * covers one full period and loops seamlessly. Pawns keep a per-channel phase in [0, Period)
+ * instead of a seed, and each frame is a table lookup plus a lerp.
+ *
+ * Quality is set with bodycam.NoiseBank.SamplesPerUnit / bodycam.NoiseBank.Quantize (read once, at build).
+ */
+class BODYCAMHORRORGAME_API FBodycamNoiseBank
+{
+public:
+	static constexpr float Period = 256.f;
+
+	/**
+	 * Largest deviation from PerlinNoise1D we accept (1% of the noise range). The lerp error is
+	 * about 0.0072 at the default 16 samples per unit and roughly quadruples per halving, so 8
+	 * (0.027) and below fail.
+	 */
+	static constexpr float MaxDeviationTolerance = 0.01f;
+
+	/** Built on first use (the motion subsystem warms it up on world init). */
+	static const FBodycamNoiseBank& Get();
+
+	/** Phase must be in [0, Period). */
+	FORCEINLINE float Sample(float Phase) const
+	{
+		const float X = Phase * SamplesPerUnit;
+		const int32 I = FMath::Min((int32)X, Mask);
+		const float A = X - (float)I;
+		const int32 J = (I + 1) & Mask;
+
+		if (bQuantized)
+		{
+			return FMath::Lerp((float)Quantized[I], (float)Quantized[J], A) * (1.f / 32767.f);
+		}
+		return FMath::Lerp(Table[I], Table[J], A);
+	}
+
+	/** Advance a phase and wrap it back into [0, Period). */
+	static FORCEINLINE float Advance(float Phase, float Delta)
+	{
+		Phase += Delta;
+		return Phase >= Period ? FMath::Fmod(Phase, Period) : Phase;
+	}
+
+	/** Map an arbitrary (seed) value onto a phase in [0, Period). */
+	static float ToPhase(float Value);
+
+	int32 GetLength() const { return Mask + 1; }
+	bool  IsQuantized() const { return bQuantized; }
+	SIZE_T GetAllocatedSize() const { return Table.GetAllocatedSize() + Quantized.GetAllocatedSize(); }
+
+	/** Largest |Sample - PerlinNoise1D| measured between table entries when the bank was built. */
+	float GetMaxDeviation() const { return MaxDeviation; }
+	bool IsWithinTolerance() const { return MaxDeviation <= MaxDeviationTolerance; }
+
+private:
+	FBodycamNoiseBank(int32 InSamplesPerUnit, bool bInQuantize);
+
+	float MeasureMaxDeviation() const;
+
+	TArray<float> Table;
+	TArray<int16> Quantized;
+	float SamplesPerUnit = 1.f;
+	int32 Mask = 0;
+	bool  bQuantized = false;
+	float MaxDeviation = 0.f;
+};
@@ -0,0 +1,219 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamPreload.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamCharacter.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace BodycamPreload
+{
+	static const FPrimaryAssetType ProfileType(TEXT("BodycamProfile"));
+
+	// on-disk size (uncooked .uasset/.umap + .uexp); 0 when it cannot be found, e.g. in an IoStore container
+	static int64 GetPackageBytes(const UPackage* Package)
+	{
+		const FString Name = Package->GetName();
+		for (const FString& Extension : { FPackageName::GetAssetPackageExtension(), FPackageName::GetMapPackageExtension() })
+		{
+			FString Filename;
+			if (!FPackageName::TryConvertLongPackageNameToFilename(Name, Filename, Extension))
+			{
+				continue;
+			}
+			const int64 HeaderBytes = IFileManager::Get().FileSize(*Filename);
+			if (HeaderBytes > 0)
+			{
+				const int64 ExportBytes = IFileManager::Get().FileSize(*FPaths::ChangeExtension(Filename, TEXT(".uexp")));
+				return HeaderBytes + FMath::Max<int64>(0, ExportBytes);
+			}
+		}
+		return 0;
+	}
+
+	static double ToMB(int64 Bytes) { return Bytes / (1024.0 * 1024.0); }
+}
+
+void UBodycamPreloadSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	bPreload = !FParse::Param(FCommandLine::Get(), TEXT("NoBodycamPreload"));
+
+	EndLoadPackageHandle = FCoreUObjectDelegates::OnEndLoadPackage.AddUObject(this, &UBodycamPreloadSubsystem::OnEndLoadPackage);
+	PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddUObject(this, &UBodycamPreloadSubsystem::OnPreLoadMap);
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &UBodycamPreloadSubsystem::OnPostLoadMap);
+
+	if (bPreload)
+	{
+		StartPreload();
+	}
+}
+
+void UBodycamPreloadSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::OnEndLoadPackage.Remove(EndLoadPackageHandle);
+	FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+
+	ClassHandle.Reset();
+	InputHandle.Reset();
+	AssetsHandle.Reset();
+	ProfilesHandle.Reset();
+	CountedPackages.Empty();
+
+	Super::Deinitialize();
+}
+
+void UBodycamPreloadSubsystem::StartPreload()
+{
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+
+	if (!PawnClass.IsNull())
+	{
+		ClassHandle = Streamable.RequestAsyncLoad(PawnClass.ToSoftObjectPath(),
+			FStreamableDelegate::CreateUObject(this, &UBodycamPreloadSubsystem::OnPawnClassLoaded),
+			FStreamableManager::AsyncLoadHighPriority);
+	}
+	if (StartupAssets.Num() > 0)
+	{
+		AssetsHandle = Streamable.RequestAsyncLoad(StartupAssets);
+	}
+	ProfilesHandle = UAssetManager::Get().LoadPrimaryAssetsWithType(BodycamPreload::ProfileType);
+}
+
+void UBodycamPreloadSubsystem::OnPawnClassLoaded()
+{
+	// the input assets are soft, so they are a second wave, read off the loaded class defaults
+	const UClass* Class = PawnClass.Get();
+	if (!Class)
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> InputAssets;
+	Class->GetDefaultObject<ABodycamCharacter>()->GatherInputAssets(InputAssets);
+	if (InputAssets.Num() > 0)
+	{
+		InputHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(InputAssets),
+			FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+	}
+}
+
+bool UBodycamPreloadSubsystem::IsPreloadComplete() const
+{
+	for (const TSharedPtr<FStreamableHandle>& Handle : { ClassHandle, InputHandle, AssetsHandle, ProfilesHandle })
+	{
+		if (Handle.IsValid() && !Handle->HasLoadCompleted())
+		{
+			return false;
+		}
+	}
+	return bPreload;
+}
+
+UClass* UBodycamPreloadSubsystem::ResolvePawnClass()
+{
+	if (PawnClass.IsNull())
+	{
+		return nullptr;
+	}
+	if (UClass* Class = PawnClass.Get())
+	{
+		return Class;
+	}
+
+	// still streaming (or preload off): this is the wait the preload is meant to hide
+	const double Start = FPlatformTime::Seconds();
+	if (ClassHandle.IsValid())
+	{
+		ClassHandle->WaitUntilComplete();
+	}
+	UClass* Class = PawnClass.LoadSynchronous();
+	PawnWaitSeconds += FPlatformTime::Seconds() - Start;
+	return Class;
+}
+
+void UBodycamPreloadSubsystem::NotifyPawnSpawned(double InSpawnSeconds)
+{
+	if (!bReported && SpawnSeconds == 0.0)
+	{
+		SpawnSeconds = InSpawnSeconds;
+	}
+}
+
+void UBodycamPreloadSubsystem::NotifyControllable(const ABodycamCharacter* Pawn)
+{
+	if (!bReported && Pawn && Pawn->IsLocallyControlled())
+	{
+		Report();
+	}
+}
+
+void UBodycamPreloadSubsystem::OnPreLoadMap(const FString& /*MapName*/)
+{
+	MapLoadStart = FPlatformTime::Seconds();
+}
+
+void UBodycamPreloadSubsystem::OnPostLoadMap(UWorld* /*World*/)
+{
+	if (!bReported && MapLoadStart > 0.0)
+	{
+		MapLoadSeconds = FPlatformTime::Seconds() - MapLoadStart;
+	}
+}
+
+void UBodycamPreloadSubsystem::OnEndLoadPackage(const FEndLoadPackageContext& Context)
+{
+	// nested sync loads report their packages again at every depth; count each package once
+	FLoadTally& Tally = Context.bSynchronous ? SyncLoads : AsyncLoads;
+	for (UPackage* Package : Context.LoadedPackages)
+	{
+		bool bAlreadyCounted = false;
+		CountedPackages.Add(Package->GetFName(), &bAlreadyCounted);
+		if (!bAlreadyCounted)
+		{
+			++Tally.Packages;
+			Tally.Bytes += BodycamPreload::GetPackageBytes(Package);
+		}
+	}
+}
+
+void UBodycamPreloadSubsystem::Report()
+{
+	bReported = true;
+	FCoreUObjectDelegates::OnEndLoadPackage.Remove(EndLoadPackageHandle);
+	CountedPackages.Empty();
+
+	const double FirstControllable = FPlatformTime::Seconds() - GStartTime;
+	const TCHAR* PreloadState = !bPreload ? TEXT("off") : IsPreloadComplete() ? TEXT("done") : TEXT("still streaming");
+
+	UE_LOG(LogBodycam, Display, TEXT("Startup: first controllable frame %.2f s after launch | map load %.2f s | first spawn %.1f ms (%.1f ms waiting for the pawn class) | sync %d packages %.2f MB | async %d packages %.2f MB | preload %s"),
+		FirstControllable, MapLoadSeconds, SpawnSeconds * 1000.0, PawnWaitSeconds * 1000.0,
+		SyncLoads.Packages, BodycamPreload::ToMB(SyncLoads.Bytes), AsyncLoads.Packages, BodycamPreload::ToMB(AsyncLoads.Bytes), PreloadState);
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("BodycamStartupReport")))
+	{
+		const FString Stamp = FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"));
+		const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("Profiling/Bodycam") / FString::Printf(TEXT("BodycamStartup-%s.csv"), *Stamp);
+
+		FString Csv = TEXT("preload,first_controllable_s,map_load_s,first_spawn_ms,pawn_wait_ms,sync_packages,sync_bytes,async_packages,async_bytes\n");
+		Csv += FString::Printf(TEXT("%d,%.3f,%.3f,%.2f,%.2f,%d,%lld,%d,%lld\n"),
+			bPreload ? 1 : 0, FirstControllable, MapLoadSeconds, SpawnSeconds * 1000.0, PawnWaitSeconds * 1000.0,
+			SyncLoads.Packages, SyncLoads.Bytes, AsyncLoads.Packages, AsyncLoads.Bytes);
+		FFileHelper::SaveStringToFile(Csv, *CsvPath);
+		UE_LOG(LogBodycam, Display, TEXT("Startup report written to %s"), *CsvPath);
+	}
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("BodycamQuitAfterStartup")))
+	{
+		FPlatformMisc::RequestExit(false, TEXT("BodycamStartupReport"));
+	}
+}
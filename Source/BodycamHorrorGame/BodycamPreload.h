@@ -0,0 +1,87 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "BodycamPreload.generated.h"
+
+class ABodycamCharacter;
+struct FEndLoadPackageContext;
+struct FStreamableHandle;
+
+/**
+ * Startup preload: as soon as the game instance exists (before the first map loads) this
+ * streams the pawn class (with its arms and flashlight content), its soft input assets and the
+ * bodycam profiles asynchronously, so the map load and the first spawn do not load them
+ * synchronously. ABodycamGameMode asks for the pawn class here and only waits if the
+ * preload has not finished by the time the player spawns.
+ *
+ * Also reports startup timing once: time to the first controllable frame, map load, first
+ * spawn, and packages / bytes loaded synchronously versus asynchronously until then.
+ *
+ *   -NoBodycamPreload            load everything on first use (for comparison)
+ *   -BodycamStartupReport        also write the report to Saved/Profiling/Bodycam
+ *   -BodycamQuitAfterStartup     exit once the report is out (e.g. with -game -nullrhi)
+ */
+UCLASS(Config=Game)
+class BODYCAMHORRORGAME_API UBodycamPreloadSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Configured pawn class, or null. Waits for the preload if it is still streaming. */
+	UClass* ResolvePawnClass();
+
+	bool IsPreloadComplete() const;
+
+	void NotifyPawnSpawned(double SpawnSeconds);
+
+	/** The local pawn has its input bound; the first call ends the startup report. */
+	void NotifyControllable(const ABodycamCharacter* Pawn);
+
+	// UGameInstanceSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+private:
+	struct FLoadTally
+	{
+		int32 Packages = 0;
+		int64 Bytes = 0;
+	};
+
+	// what ABodycamGameMode spawns (set in DefaultGame.ini)
+	UPROPERTY(Config)
+	TSoftClassPtr<ABodycamCharacter> PawnClass;
+
+	// anything else worth having before the first frame
+	UPROPERTY(Config)
+	TArray<FSoftObjectPath> StartupAssets;
+
+	void StartPreload();
+	void OnPawnClassLoaded();
+	void OnPreLoadMap(const FString& MapName);
+	void OnPostLoadMap(UWorld* World);
+	void OnEndLoadPackage(const FEndLoadPackageContext& Context);
+	void Report();
+
+	TSharedPtr<FStreamableHandle> ClassHandle;
+	TSharedPtr<FStreamableHandle> InputHandle;
+	TSharedPtr<FStreamableHandle> AssetsHandle;
+	TSharedPtr<FStreamableHandle> ProfilesHandle;
+
+	FLoadTally SyncLoads;
+	FLoadTally AsyncLoads;
+	TSet<FName> CountedPackages;
+	double MapLoadStart = 0.0;
+	double MapLoadSeconds = 0.0;
+	double SpawnSeconds = 0.0;
+	double PawnWaitSeconds = 0.0;
+	bool bPreload = true;
+	bool bReported = false;
+
+	FDelegateHandle PreLoadMapHandle;
+	FDelegateHandle PostLoadMapHandle;
+	FDelegateHandle EndLoadPackageHandle;
+};
@@ -0,0 +1,65 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamProfile.h"
+#include "BodycamHorrorGame.h"
+#include "UObject/EnumProperty.h"
+
+bool FBodycamTuning::operator==(const FBodycamTuning& Other) const
+{
+	return StaticStruct()->CompareScriptStruct(this, &Other, PPF_None);
+}
+
+FBodycamTuning UBodycamProfile::Resolve(const UBodycamProfile* Profile, TConstArrayView<FBodycamTuningOverride> Overrides)
+{
+	FBodycamTuning Out = (Profile ? Profile : GetDefault<UBodycamProfile>())->Tuning;
+
+	for (const FBodycamTuningOverride& Override : Overrides)
+	{
+		const FProperty* Prop = FBodycamTuning::StaticStruct()->FindPropertyByName(Override.Property);
+		if (const FFloatProperty* FloatProp = CastField<FFloatProperty>(Prop))
+		{
+			FloatProp->SetPropertyValue_InContainer(&Out, Override.Value);
+		}
+		else if (const FBoolProperty* BoolProp = CastField<FBoolProperty>(Prop))
+		{
+			BoolProp->SetPropertyValue_InContainer(&Out, Override.Value != 0.f);
+		}
+		else if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Prop))
+		{
+			const int64 EnumValue = FMath::RoundToInt64(Override.Value);
+			if (EnumProp->GetEnum()->IsValidEnumValue(EnumValue))
+			{
+				EnumProp->GetUnderlyingProperty()->SetIntPropertyValue(EnumProp->ContainerPtrToValuePtr<void>(&Out), EnumValue);
+			}
+			else
+			{
+				UE_LOG(LogBodycam, Warning, TEXT("Bodycam tuning override '%s' = %g is not a %s value"),
+					*Override.Property.ToString(), Override.Value, *EnumProp->GetEnum()->GetName());
+			}
+		}
+		else if (!Override.Property.IsNone())
+		{
+			UE_LOG(LogBodycam, Warning, TEXT("Unknown bodycam tuning override '%s'"), *Override.Property.ToString());
+		}
+	}
+
+	// overrides (and assets saved before the clamp) skip the editor metadata
+	Out.FlashAimMaxYaw   = FMath::Clamp(Out.FlashAimMaxYaw,   0.f, FBodycamTuning::FlashAimLimit);
+	Out.FlashAimMaxPitch = FMath::Clamp(Out.FlashAimMaxPitch, 0.f, FBodycamTuning::FlashAimLimit);
+	return Out;
+}
+
+TArray<FName> UBodycamProfile::GetTuningPropertyNames()
+{
+	TArray<FName> Names;
+	for (TFieldIterator<FProperty> It(FBodycamTuning::StaticStruct()); It; ++It)
+	{
+		// only the types Resolve knows how to write
+		if (It->IsA<FFloatProperty>() || It->IsA<FBoolProperty>() || It->IsA<FEnumProperty>())
+		{
+			Names.Add(It->GetFName());
+		}
+	}
+	return Names;
+}
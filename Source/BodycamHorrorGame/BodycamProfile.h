@@ -0,0 +1,241 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Engine/EngineTypes.h"
+#include "BodycamProfile.generated.h"
+
+class USoundBase;
+
+/** Which set of motion channels the camera runs (stacks are in BodycamMotionStack.h). */
+UENUM(BlueprintType)
+enum class EBodycamMotionStack : uint8
+{
+	Player,     // everything
+	NPC,        // gait and kicks, no breathing or strafe roll
+	Cinematic,  // breathing and gait only
+};
+
+/** Bodycam feel: headbob, breathing, roll, landing, sprint, FOV and flashlight behaviour. */
+USTRUCT(BlueprintType)
+struct BODYCAMHORRORGAME_API FBodycamTuning
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam")
+	EBodycamMotionStack MotionStack = EBodycamMotionStack::Player;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Headbob")
+	float BobIntensity = 0.7f;              // cm up/down when moving
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Headbob")
+	float BobFrequency = 4.5f;              // how fast the bob oscillates
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Headbob")
+	float CrouchBobScale = 0.65f;           // bob reduced while crouched
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Headbob")
+	float SprintBobScale = 1.4f;            // bob amplified at high speed
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Headbob")
+	float BobHorizontal = 0.25f; // Y cm (side sway)
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Headbob")
+	float BobForward   = 0.35f; // X cm (forward surge)
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Headbob")
+	float BobPitchDeg  = 0.4f;  // camera nod in degrees
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Breathing")
+	float BreathIntensity = 0.25f;          // cm idle breathing
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Breathing")
+	float BreathXYIntensity = 0.25f;          // cm idle breathing
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Breathing")
+	float BreathPitchDeg  = 0.4f;  // camera nod in degrees
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Breathing")
+	float BreathFrequency = 1.1f;           // Hz-ish
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Breathing")
+	float BreathRollDeg = 0.25f;          // slight roll with breathing
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Breathing")
+	float BreathNoiseSpeed = 0.9f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Roll")
+	float StrafeRollDeg = 2.0f;             // max roll when strafing
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Roll")
+	float RollInterpSpeed = 6.0f;           // smoothing
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Landing")
+	float LandingKick = 3.0f;               // cm downward kick on land
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Landing")
+	float LandingDamp = 12.0f;              // how fast the kick fades
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Landing")
+	float JumpKickUp = 2.0f; // cm
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam|Landing")
+	float JumpDamp   = 10.0f;
+
+	// ===== Sprint =====
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Movement|Sprint")
+	float WalkSpeed = 250.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Movement|Sprint")
+	float SprintSpeed = 500.f;
+
+	// ===== FOV (sensor feel) =====
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Camera|FOV")
+	float BaseFOV = 95.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Camera|FOV")
+	float SprintFOV = 101.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Camera|FOV")
+	float FOVInterpSpeed = 6.f;
+
+	// --- Flashlight free-aim (beam moves first, then camera) ---
+	// limits stay inside what FBodycamNetState replicates (int8 at 1/8 deg)
+	static constexpr float FlashAimLimit = 15.875f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|FreeAim", meta=(ClampMin="0", ClampMax="15.875", UIMax="15.875")) float FlashAimMaxYaw   = 10.f; // deg
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|FreeAim", meta=(ClampMin="0", ClampMax="15.875", UIMax="15.875")) float FlashAimMaxPitch = 8.f;  // deg
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|FreeAim") float FlashAimReturnSpeed = 4.f;   // recenter
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|FreeAim") float FlashAimSmoothing   = 12.f;  // visual smoothing
+
+	// convert look input to degrees that fill the free-aim
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|FreeAim") float LookToDegYaw   = 1.0f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|FreeAim") float LookToDegPitch = 1.0f;
+
+	// Flip directions if your mouse/asset axes feel reversed
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|FreeAim")
+	bool bInvertFlashAimPitch = true;   // try true first (mouse up -> beam up)
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|FreeAim")
+	bool bInvertFlashAimYaw = false;    // usually fine; set true if left/right feels backwards
+
+	// Camera sensitivity (leftover input -> camera), independent of flashlight
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|FreeAim")
+	float CameraYawDegPerInput   = 1.0f;   // how many degrees the CAMERA turns per 1.0 input unit (yaw)
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|FreeAim")
+	float CameraPitchDegPerInput = 1.0f;   // degrees per 1.0 input unit (pitch)
+
+	// Small fraction of input that always reaches the camera (prevents "stun")
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|FreeAim", meta=(ClampMin="0.0", ClampMax="1.0"))
+	float FreeAimLeak = 0.18f;             // 0 = hard deadzone, 0.15~0.30 = soft/comfortable
+
+	// --- Flashlight movement sway (while walking/sprinting) ---
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|Move")
+	float FlashMoveYawByStrafe   = 4.0f; // deg at full strafe
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|Move")
+	float FlashMovePitchBySpeed = 2.5f;  // deg nose-down at full forward speed
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|Move")
+	float FlashSprintSwayScale  = 1.35f; // extra during sprint
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|Move")
+	float FlashBobYaw           = 0.8f;  // tie sway to your bob phase
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|Move")
+	float FlashBobPitch         = 0.5f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|Move")
+	float FlashMoveInterp       = 8.0f;  // smoothing
+
+	// --- Flashlight impulses on jump/land ---
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|Jump")
+	float FlashJumpPitchKick   = 4.0f;   // up on takeoff (+)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|Jump")
+	float FlashLandPitchKick   = -6.0f;  // dip on landing (-)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Flashlight|Jump")
+	float FlashKickReturnSpeed = 12.0f;  // decay
+
+	float GetFlashAimPitchSign() const { return bInvertFlashAimPitch ? -1.f : 1.f; }
+	float GetFlashAimYawSign() const   { return bInvertFlashAimYaw   ? -1.f : 1.f; }
+
+	bool operator==(const FBodycamTuning& Other) const;
+};
+
+/** One tuning value a single pawn changes on top of its profile. */
+USTRUCT(BlueprintType)
+struct BODYCAMHORRORGAME_API FBodycamTuningOverride
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam", meta=(GetOptions="BodycamProfile.GetTuningPropertyNames"))
+	FName Property;
+
+	// bools: 0 = false, anything else = true; enums: the enumerator's value (MotionStack: 0 Player, 1 NPC, 2 Cinematic)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam")
+	float Value = 0.f;
+};
+
+/** Footsteps (per physical surface), landing and breathing sounds. */
+USTRUCT(BlueprintType)
+struct BODYCAMHORRORGAME_API FBodycamAudio
+{
+	GENERATED_BODY()
+
+	// surfaces not listed in SurfaceFootsteps use this
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Audio")
+	TObjectPtr<USoundBase> Footstep;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Audio")
+	TMap<TEnumAsByte<EPhysicalSurface>, TObjectPtr<USoundBase>> SurfaceFootsteps;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Audio")
+	TObjectPtr<USoundBase> Landing;
+
+	// looping; volume follows the breath level (noise + sprint)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Audio")
+	TObjectPtr<USoundBase> BreathingLoop;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Audio")
+	float FootstepVolume = 0.8f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Audio")
+	float LandingVolume = 1.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Audio")
+	float BreathVolume = 0.6f;              // at full breath level
+
+	USoundBase* GetFootstep(EPhysicalSurface Surface) const
+	{
+		const TObjectPtr<USoundBase>* Found = SurfaceFootsteps.Find(Surface);
+		return Found && *Found ? Found->Get() : Footstep.Get();
+	}
+};
+
+/**
+ * Shared bodycam tuning and sounds (patrol officer, panicked civilian, ...). Pawns reference a
+ * profile and list overrides only for the values they change; swapping the profile swaps the
+ * whole feel.
+ * Pawns without a profile use the defaults of this class.
+ */
+UCLASS(BlueprintType)
+class BODYCAMHORRORGAME_API UBodycamProfile : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bodycam", meta=(ShowOnlyInnerProperties))
+	FBodycamTuning Tuning;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Audio")
+	FBodycamAudio Audio;
+
+	/** Profile audio, or the class defaults'. */
+	static const FBodycamAudio& GetAudio(const UBodycamProfile* Profile)
+	{
+		return (Profile ? Profile : GetDefault<UBodycamProfile>())->Audio;
+	}
+
+	/** Profile (or the class defaults) with the overrides applied on top. */
+	static FBodycamTuning Resolve(const UBodycamProfile* Profile, TConstArrayView<FBodycamTuningOverride> Overrides);
+
+	UFUNCTION()
+	static TArray<FName> GetTuningPropertyNames();
+};
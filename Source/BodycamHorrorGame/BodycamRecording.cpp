@@ -0,0 +1,211 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamRecording.h"
+#include "BodycamHorrorGame.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+namespace BodycamRecord
+{
+	static constexpr float MoveScale  = 16384.f;
+	static constexpr float PhaseScale = 256.f;
+}
+
+void FBodycamRecordFrame::SetMoveInput(const FVector& Input)
+{
+	MoveX = (int16)FMath::Clamp(FMath::RoundToInt(Input.X * BodycamRecord::MoveScale), -32767, 32767);
+	MoveY = (int16)FMath::Clamp(FMath::RoundToInt(Input.Y * BodycamRecord::MoveScale), -32767, 32767);
+}
+
+FVector FBodycamRecordFrame::GetMoveInput() const
+{
+	return FVector(MoveX / BodycamRecord::MoveScale, MoveY / BodycamRecord::MoveScale, 0.f);
+}
+
+void FBodycamRecordFrame::SetState(const FBodycamRecordState& State)
+{
+	BobTime = State.BobTime;
+	for (int32 c = 0; c < UE_ARRAY_COUNT(BreathPhase); ++c)
+	{
+		BreathPhase[c] = (uint16)(FMath::RoundToInt(State.BreathPhase[c] * BodycamRecord::PhaseScale) & 0xFFFF);
+	}
+	LandingOffset  = State.LandingOffset;
+	JumpOffset     = State.JumpOffset;
+	FlashAimYaw    = State.FlashAimYaw;
+	FlashAimPitch  = State.FlashAimPitch;
+	FlashKickPitch = State.FlashKickPitch;
+}
+
+FBodycamRecordState FBodycamRecordFrame::GetState() const
+{
+	FBodycamRecordState State;
+	State.BobTime = BobTime;
+	for (int32 c = 0; c < UE_ARRAY_COUNT(BreathPhase); ++c)
+	{
+		State.BreathPhase[c] = BreathPhase[c] / BodycamRecord::PhaseScale;
+	}
+	State.LandingOffset  = LandingOffset.GetFloat();
+	State.JumpOffset     = JumpOffset.GetFloat();
+	State.FlashAimYaw    = FlashAimYaw.GetFloat();
+	State.FlashAimPitch  = FlashAimPitch.GetFloat();
+	State.FlashKickPitch = FlashKickPitch.GetFloat();
+	return State;
+}
+
+void FBodycamRecordFrame::SetControlRotation(const FRotator& Rotation)
+{
+	ControlPitch = FRotator::CompressAxisToShort(Rotation.Pitch);
+	ControlYaw   = FRotator::CompressAxisToShort(Rotation.Yaw);
+}
+
+FRotator FBodycamRecordFrame::GetControlRotation() const
+{
+	return FRotator(FRotator::DecompressAxisFromShort(ControlPitch), FRotator::DecompressAxisFromShort(ControlYaw), 0.f);
+}
+
+FArchive& operator<<(FArchive& Ar, FBodycamRecordFrame& Frame)
+{
+	Ar << Frame.DeltaSeconds;
+	Ar << Frame.MoveX << Frame.MoveY;
+	Ar << Frame.LookX.Encoded << Frame.LookY.Encoded;
+	Ar << Frame.Buttons;
+	Ar << Frame.BobTime;
+	for (uint16& Phase : Frame.BreathPhase)
+	{
+		Ar << Phase;
+	}
+	Ar << Frame.LandingOffset.Encoded << Frame.JumpOffset.Encoded;
+	Ar << Frame.FlashAimYaw.Encoded << Frame.FlashAimPitch.Encoded << Frame.FlashKickPitch.Encoded;
+	Ar << Frame.Location.X << Frame.Location.Y << Frame.Location.Z;
+	Ar << Frame.ControlPitch << Frame.ControlYaw;
+	return Ar;
+}
+
+// ---------------------------------------------------------------------------------------------
+
+bool FBodycamRecording::Save(const FString& Path, TConstArrayView<FBodycamRecordFrame> Frames)
+{
+	TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileWriter(*Path));
+	if (!Ar)
+	{
+		return false;
+	}
+
+	uint32 FileMagic = Magic;
+	uint32 FileVersion = Version;
+	int32 NumFrames = Frames.Num();
+	*Ar << FileMagic << FileVersion << NumFrames;
+	for (const FBodycamRecordFrame& Frame : Frames)
+	{
+		*Ar << const_cast<FBodycamRecordFrame&>(Frame);
+	}
+	ensureMsgf(Ar->Tell() == HeaderSize + (int64)NumFrames * FBodycamRecordFrame::SerializedSize,
+		TEXT("FBodycamRecordFrame::SerializedSize is out of date with its serializer"));
+	return Ar->Close();
+}
+
+bool FBodycamRecording::Load(const FString& Path, TArray<FBodycamRecordFrame>& OutFrames)
+{
+	TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileReader(*Path));
+	if (!Ar)
+	{
+		return false;
+	}
+
+	uint32 FileMagic = 0;
+	uint32 FileVersion = 0;
+	int32 NumFrames = 0;
+	*Ar << FileMagic << FileVersion << NumFrames;
+	if (Ar->IsError() || FileMagic != Magic || FileVersion != Version || NumFrames < 0)
+	{
+		UE_LOG(LogBodycam, Error, TEXT("%s is not a bodycam recording (or an old version)"), *Path);
+		return false;
+	}
+
+	// the count comes from the file: check it against what is actually there before allocating
+	const int64 Remaining = Ar->TotalSize() - Ar->Tell();
+	if (Remaining != (int64)NumFrames * FBodycamRecordFrame::SerializedSize)
+	{
+		UE_LOG(LogBodycam, Error, TEXT("%s is truncated or corrupt: %d frames need %lld bytes, %lld left"),
+			*Path, NumFrames, (int64)NumFrames * FBodycamRecordFrame::SerializedSize, Remaining);
+		return false;
+	}
+
+	OutFrames.SetNum(NumFrames);
+	for (FBodycamRecordFrame& Frame : OutFrames)
+	{
+		*Ar << Frame;
+	}
+	if (Ar->IsError())
+	{
+		UE_LOG(LogBodycam, Error, TEXT("Could not read %s"), *Path);
+		OutFrames.Reset();
+		return false;
+	}
+	return true;
+}
+
+FString FBodycamRecording::MakeDefaultPath(const TCHAR* Prefix)
+{
+	return FPaths::ProjectSavedDir() / TEXT("Bodycam") / FString::Printf(TEXT("%s-%s.bcrec"), Prefix, *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")));
+}
+
+// ---------------------------------------------------------------------------------------------
+
+FBodycamRecorder::FBodycamRecorder(int32 InCapacity)
+{
+	const int32 Capacity = FMath::Max(1, InCapacity);
+	Ring.SetNumZeroed(Capacity);
+	SaveFrames.Reserve(Capacity);
+}
+
+FBodycamRecorder::~FBodycamRecorder()
+{
+	WaitForSave();
+}
+
+void FBodycamRecorder::Add(const FBodycamRecordFrame& Frame)
+{
+	Ring[Head] = Frame;
+	Head = (Head + 1) % Ring.Num();
+	Count = FMath::Min(Count + 1, Ring.Num());
+}
+
+bool FBodycamRecorder::SaveAsync(const FString& Path)
+{
+	if (Count == 0 || IsSaving())
+	{
+		return false;
+	}
+
+	// oldest frame first; capacity was reserved up front so this never reallocates
+	SaveFrames.Reset();
+	const int32 Oldest = (Head - Count + Ring.Num()) % Ring.Num();
+	for (int32 i = 0; i < Count; ++i)
+	{
+		SaveFrames.Add(Ring[(Oldest + i) % Ring.Num()]);
+	}
+
+	PendingSave = Async(EAsyncExecution::ThreadPool, [this, Path]()
+	{
+		const bool bSaved = FBodycamRecording::Save(Path, SaveFrames);
+		UE_LOG(LogBodycam, Display, TEXT("Bodycam recording %s: %s (%d frames)"), bSaved ? TEXT("saved") : TEXT("FAILED"), *Path, SaveFrames.Num());
+		return bSaved;
+	});
+	return true;
+}
+
+bool FBodycamRecorder::IsSaving() const
+{
+	return PendingSave.IsValid() && !PendingSave.IsReady();
+}
+
+void FBodycamRecorder::WaitForSave()
+{
+	if (PendingSave.IsValid())
+	{
+		PendingSave.Wait();
+	}
+}
@@ -0,0 +1,114 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Math/Float16.h"
+
+/** Bodycam runtime state of one pawn, as exchanged with UBodycamMotionSubsystem. */
+struct FBodycamRecordState
+{
+	float BobTime = 0.f;
+	float BreathPhase[5] = {}; // X, Y, Z, pitch, roll (FBodycamNoiseBank phases)
+	float LandingOffset = 0.f;
+	float JumpOffset = 0.f;
+	float FlashAimYaw = 0.f;
+	float FlashAimPitch = 0.f;
+	float FlashKickPitch = 0.f;
+};
+
+/**
+ * One recorded frame (53 bytes on disk). State and transform are taken at the start of the
+ * frame, input is what the frame consumed. Everything but the delta time, bob time and location
+ * is quantized; playback only ever sees the quantized values, so replays match each other exactly.
+ */
+struct BODYCAMHORRORGAME_API FBodycamRecordFrame
+{
+	enum EButtons : uint8
+	{
+		B_Sprint     = 1 << 0,
+		B_Jump       = 1 << 1, // held
+		B_Flashlight = 1 << 2, // on
+	};
+
+	/** Bytes operator<< reads / writes per frame; update it with the serializer. */
+	static constexpr int32 SerializedSize = 53;
+
+	float DeltaSeconds = 0.f;
+
+	// input
+	int16    MoveX = 0, MoveY = 0; // world-space movement input, 1/16384 units
+	FFloat16 LookX, LookY;         // raw look input summed over the frame
+	uint8    Buttons = 0;
+
+	// state
+	float    BobTime = 0.f;
+	uint16   BreathPhase[5] = {};  // 1/256 units (phases are < 256)
+	FFloat16 LandingOffset, JumpOffset;
+	FFloat16 FlashAimYaw, FlashAimPitch, FlashKickPitch;
+
+	// transform
+	FVector3f Location = FVector3f::ZeroVector;
+	uint16    ControlPitch = 0, ControlYaw = 0; // FRotator::CompressAxisToShort
+
+	void SetMoveInput(const FVector& Input);
+	FVector GetMoveInput() const;
+
+	void SetLookInput(const FVector2f& Input) { LookX = Input.X; LookY = Input.Y; }
+	FVector2f GetLookInput() const { return FVector2f(LookX.GetFloat(), LookY.GetFloat()); }
+
+	void SetState(const FBodycamRecordState& State);
+	FBodycamRecordState GetState() const;
+
+	void SetControlRotation(const FRotator& Rotation);
+	FRotator GetControlRotation() const;
+
+	friend FArchive& operator<<(FArchive& Ar, FBodycamRecordFrame& Frame);
+};
+
+/** Recording files (.bcrec, written to Saved/Bodycam by default). */
+struct BODYCAMHORRORGAME_API FBodycamRecording
+{
+	static constexpr uint32 Magic = 0x43524342; // "BCRC"
+	static constexpr uint32 Version = 1;
+	static constexpr int32 HeaderSize = 12; // magic, version, frame count
+
+	static bool Save(const FString& Path, TConstArrayView<FBodycamRecordFrame> Frames);
+
+	/** Fails on a bad header or when the file size does not match the frame count. */
+	static bool Load(const FString& Path, TArray<FBodycamRecordFrame>& OutFrames);
+
+	/** Saved/Bodycam/<Prefix>-<timestamp>.bcrec */
+	static FString MakeDefaultPath(const TCHAR* Prefix);
+};
+
+/**
+ * Fixed-size ring of recorded frames: the last Capacity frames are kept, nothing is allocated
+ * after construction. SaveAsync copies the ring into a second preallocated buffer and writes it
+ * out on a worker thread.
+ */
+class BODYCAMHORRORGAME_API FBodycamRecorder
+{
+public:
+	explicit FBodycamRecorder(int32 InCapacity);
+	~FBodycamRecorder();
+
+	void Add(const FBodycamRecordFrame& Frame);
+
+	int32 Num() const { return Count; }
+	int32 GetCapacity() const { return Ring.Num(); }
+
+	/** False if the ring is empty or the previous save is still being written. */
+	bool SaveAsync(const FString& Path);
+	bool IsSaving() const;
+	void WaitForSave();
+
+private:
+	TArray<FBodycamRecordFrame> Ring;
+	TArray<FBodycamRecordFrame> SaveFrames; // owned by the writer task while a save is in flight
+	int32 Head = 0;  // next slot to write
+	int32 Count = 0;
+
+	TFuture<bool> PendingSave;
+};
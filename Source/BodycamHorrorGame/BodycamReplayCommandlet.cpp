@@ -0,0 +1,174 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamReplayCommandlet.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamBenchmarkCommandlet.h"
+#include "BodycamCharacter.h"
+#include "BodycamRecording.h"
+#include "BodycamReplaySubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/IConsoleManager.h"
+
+namespace BodycamReplayTool
+{
+	// bytes per pose in UBodycamReplaySubsystem::SerializePoseTrack
+	static constexpr int32 PoseBytes = 11 * sizeof(float);
+}
+
+UBodycamReplayCommandlet::UBodycamReplayCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UBodycamReplayCommandlet::Main(const FString& Params)
+{
+	FString File;
+	if (!FParse::Value(*Params, TEXT("File="), File))
+	{
+		UE_LOG(LogBodycam, Error, TEXT("Usage: -run=BodycamReplay -File=<recording.bcrec> [-Runs=2] [-Blueprint] [-Out=<dir>] [-Baseline=<track>] [-FixedRate=60]"));
+		return 1;
+	}
+
+	TArray<FBodycamRecordFrame> Frames;
+	if (!FBodycamRecording::Load(File, Frames) || Frames.Num() == 0)
+	{
+		UE_LOG(LogBodycam, Error, TEXT("Could not load %s"), *File);
+		return 1;
+	}
+
+	int32 Runs = 2;
+	FParse::Value(*Params, TEXT("Runs="), Runs);
+	Runs = FMath::Max(1, Runs);
+
+	FString OutDir = FPaths::ProjectSavedDir() / TEXT("Profiling/Bodycam");
+	FParse::Value(*Params, TEXT("Out="), OutDir);
+
+	UClass* PawnClass = ABodycamCharacter::StaticClass();
+	if (FParse::Param(*Params, TEXT("Blueprint")))
+	{
+		if (UClass* BPClass = LoadClass<ABodycamCharacter>(nullptr, TEXT("/Game/BP/BP_BodycamCharacter.BP_BodycamCharacter_C")))
+		{
+			PawnClass = BPClass;
+		}
+		else
+		{
+			UE_LOG(LogBodycam, Warning, TEXT("BP_BodycamCharacter could not be loaded, playing back with the native class"));
+		}
+	}
+
+	TArray<uint8> Reference;
+	FString BaselinePath;
+	if (FParse::Value(*Params, TEXT("Baseline="), BaselinePath) && !FFileHelper::LoadFileToArray(Reference, *BaselinePath))
+	{
+		UE_LOG(LogBodycam, Error, TEXT("Could not load baseline track %s"), *BaselinePath);
+		return 1;
+	}
+
+	// the recorded pawn was viewed; the headless one is not, so keep it stepping every frame
+	if (IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("bodycam.Motion.UnviewedRate")))
+	{
+		CVar->Set(-1.f);
+	}
+
+	// 0 plays back with the variable step the recording was made with
+	float FixedRate = 0.f;
+	FParse::Value(*Params, TEXT("FixedRate="), FixedRate);
+	if (IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("bodycam.Motion.FixedRate")))
+	{
+		CVar->Set(FixedRate);
+	}
+
+	const FString Name = FPaths::GetBaseFilename(File);
+	bool bAllMatch = true;
+	for (int32 Run = 0; Run < Runs; ++Run)
+	{
+		TArray<uint8> Track;
+		float MaxDrift = 0.f;
+		if (!PlayOnce(PawnClass, Frames, Track, MaxDrift))
+		{
+			UE_LOG(LogBodycam, Error, TEXT("Playback run %d failed"), Run);
+			return 1;
+		}
+
+		const FString TrackPath = OutDir / FString::Printf(TEXT("%s-run%d.povtrack"), *Name, Run);
+		FFileHelper::SaveArrayToFile(Track, *TrackPath);
+		UE_LOG(LogBodycam, Display, TEXT("Run %d: %d poses, crc %08x, max drift from recording %.3f cm -> %s"),
+			Run, Track.Num() / BodycamReplayTool::PoseBytes, FCrc::MemCrc32(Track.GetData(), Track.Num()), MaxDrift, *TrackPath);
+
+		// the first run is the reference unless a baseline was given
+		if (Reference.Num() == 0 && BaselinePath.IsEmpty())
+		{
+			Reference = MoveTemp(Track);
+			continue;
+		}
+
+		const int32 Mismatch = FindFirstMismatch(Reference, Track);
+		if (Mismatch != INDEX_NONE)
+		{
+			UE_LOG(LogBodycam, Error, TEXT("Run %d differs from the reference starting at frame %d"), Run, Mismatch);
+			bAllMatch = false;
+		}
+	}
+
+	UE_LOG(LogBodycam, Display, TEXT("Bodycam replay %s"), bAllMatch ? TEXT("deterministic: all pose tracks identical") : TEXT("MISMATCH"));
+	return bAllMatch ? 0 : 1;
+}
+
+bool UBodycamReplayCommandlet::PlayOnce(UClass* PawnClass, const TArray<FBodycamRecordFrame>& Frames, TArray<uint8>& OutTrack, float& OutMaxDrift)
+{
+	UWorld* World = UBodycamBenchmarkCommandlet::CreateBenchmarkWorld(TEXT("BodycamReplay"));
+	UBodycamReplaySubsystem* Replay = World ? World->GetSubsystem<UBodycamReplaySubsystem>() : nullptr;
+	if (!Replay)
+	{
+		UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+		return false;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	ABodycamCharacter* Pawn = World->SpawnActor<ABodycamCharacter>(PawnClass, FVector(Frames[0].Location), Frames[0].GetControlRotation(), SpawnParams);
+	if (!Pawn)
+	{
+		UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+		return false;
+	}
+	// no controller here; movement still runs, ticked by the world as usual
+	Pawn->GetCharacterMovement()->bRunPhysicsWithNoController = true;
+
+	TArray<FBodycamRecordFrame> Copy = Frames;
+	Replay->StartPlayback(Pawn, MoveTemp(Copy));
+	while (Replay->IsPlaying())
+	{
+		World->Tick(LEVELTICK_All, Replay->GetPlaybackDeltaSeconds());
+		++GFrameCounter;
+	}
+	Replay->StopPlayback();
+
+	UBodycamReplaySubsystem::SerializePoseTrack(Replay->GetPoseTrack(), OutTrack);
+	OutMaxDrift = Replay->GetMaxDrift();
+
+	UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+	return true;
+}
+
+int32 UBodycamReplayCommandlet::FindFirstMismatch(const TArray<uint8>& A, const TArray<uint8>& B)
+{
+	const int32 Common = FMath::Min(A.Num(), B.Num());
+	for (int32 Offset = 0; Offset < Common; Offset += BodycamReplayTool::PoseBytes)
+	{
+		const int32 Len = FMath::Min(BodycamReplayTool::PoseBytes, Common - Offset);
+		if (FMemory::Memcmp(A.GetData() + Offset, B.GetData() + Offset, Len) != 0)
+		{
+			return Offset / BodycamReplayTool::PoseBytes;
+		}
+	}
+	return A.Num() == B.Num() ? INDEX_NONE : Common / BodycamReplayTool::PoseBytes;
+}
@@ -0,0 +1,36 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BodycamReplayCommandlet.generated.h"
+
+/**
+ * Headless playback of a bodycam recording (see UBodycamReplaySubsystem).
+ *
+ *   UnrealEditor-Cmd BodycamHorrorGame -run=BodycamReplay -nullrhi -unattended -File=<.bcrec>
+ *       [-Runs=2] [-Blueprint] [-Out=<dir>] [-Baseline=<.povtrack>] [-FixedRate=60]
+ *
+ * Plays the file Runs times, each in a fresh world with the recorded frame times, writes the
+ * resulting view pose track of each run to Saved/Profiling/Bodycam and checks that all runs
+ * (and the baseline track, if given) are identical byte for byte. Returns 1 on any mismatch.
+ * -FixedRate runs the motion at bodycam.Motion.FixedRate; tracks are only comparable between
+ * runs made with the same rate.
+ */
+UCLASS()
+class UBodycamReplayCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBodycamReplayCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	bool PlayOnce(UClass* PawnClass, const TArray<struct FBodycamRecordFrame>& Frames, TArray<uint8>& OutTrack, float& OutMaxDrift);
+
+	/** Index of the first pose that differs, or INDEX_NONE. */
+	static int32 FindFirstMismatch(const TArray<uint8>& A, const TArray<uint8>& B);
+};
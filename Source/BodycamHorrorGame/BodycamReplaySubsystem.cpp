@@ -0,0 +1,387 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamReplaySubsystem.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamCharacter.h"
+#include "Components/SpotLightComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryWriter.h"
+
+static float GBodycamRecordSpikeMs = 0.f;
+static FAutoConsoleVariableRef CVarBodycamRecordSpikeMs(
+	TEXT("bodycam.Record.SpikeMs"),
+	GBodycamRecordSpikeMs,
+	TEXT("While recording, save the ring buffer automatically when a frame takes longer than this (ms, 0 = off)."));
+
+namespace BodycamReplay
+{
+	static constexpr int32  DefaultCapacityFrames = 7200; // ~2 min at 60 fps
+	static constexpr double SpikeSaveCooldown = 10.0;     // s
+
+	static ABodycamCharacter* GetLocalPawn(UWorld* World)
+	{
+		APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+		return PC ? Cast<ABodycamCharacter>(PC->GetPawn()) : nullptr;
+	}
+
+	static UBodycamReplaySubsystem* GetSubsystem(UWorld* World)
+	{
+		return World ? World->GetSubsystem<UBodycamReplaySubsystem>() : nullptr;
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CmdBodycamRecordStart(
+	TEXT("bodycam.Record.Start"),
+	TEXT("Record the local bodycam pawn into a ring buffer. Args: [Frames=7200]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UBodycamReplaySubsystem* Replay = BodycamReplay::GetSubsystem(World))
+		{
+			const int32 Frames = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : BodycamReplay::DefaultCapacityFrames;
+			Replay->StartRecording(BodycamReplay::GetLocalPawn(World), Frames);
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs CmdBodycamRecordSave(
+	TEXT("bodycam.Record.Save"),
+	TEXT("Write the recording ring buffer to disk in the background. Args: [Path]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UBodycamReplaySubsystem* Replay = BodycamReplay::GetSubsystem(World))
+		{
+			Replay->SaveRecording(Args.Num() > 0 ? Args[0] : FBodycamRecording::MakeDefaultPath(TEXT("Bodycam")));
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs CmdBodycamRecordStop(
+	TEXT("bodycam.Record.Stop"),
+	TEXT("Save the recording and stop. Args: [Path]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UBodycamReplaySubsystem* Replay = BodycamReplay::GetSubsystem(World))
+		{
+			Replay->StopRecording(Args.Num() > 0 ? Args[0] : FBodycamRecording::MakeDefaultPath(TEXT("Bodycam")));
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs CmdBodycamReplayPlay(
+	TEXT("bodycam.Replay.Play"),
+	TEXT("Drive the local bodycam pawn from a recording. Args: <Path>"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UBodycamReplaySubsystem* Replay = BodycamReplay::GetSubsystem(World);
+		TArray<FBodycamRecordFrame> Frames;
+		if (Replay && Args.Num() > 0 && FBodycamRecording::Load(Args[0], Frames))
+		{
+			Replay->StartPlayback(BodycamReplay::GetLocalPawn(World), MoveTemp(Frames));
+		}
+	}));
+
+static FAutoConsoleCommandWithWorld CmdBodycamReplayStop(
+	TEXT("bodycam.Replay.Stop"),
+	TEXT("Stop bodycam playback."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UBodycamReplaySubsystem* Replay = BodycamReplay::GetSubsystem(World))
+		{
+			Replay->StopPlayback();
+		}
+	}));
+
+// ---------------------------------------------------------------------------------------------
+
+void UBodycamReplaySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PreActorTickHandle  = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &UBodycamReplaySubsystem::OnPreActorTick);
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UBodycamReplaySubsystem::OnPostActorTick);
+}
+
+void UBodycamReplaySubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+
+	StopPlayback();
+	Recorder.Reset(); // waits for a save in flight
+
+	Super::Deinitialize();
+}
+
+bool UBodycamReplaySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UBodycamReplaySubsystem::StartRecording(ABodycamCharacter* Pawn, int32 CapacityFrames)
+{
+	if (!Pawn)
+	{
+		UE_LOG(LogBodycam, Warning, TEXT("bodycam.Record.Start: no bodycam pawn to record"));
+		return false;
+	}
+
+	if (Recorder)
+	{
+		Recorder->WaitForSave();
+	}
+	Recorder = MakeUnique<FBodycamRecorder>(CapacityFrames);
+	RecordedPawn = Pawn;
+	bFrameStarted = false;
+	UE_LOG(LogBodycam, Display, TEXT("Recording %s (%d frame ring)"), *Pawn->GetName(), Recorder->GetCapacity());
+	return true;
+}
+
+bool UBodycamReplaySubsystem::SaveRecording(const FString& Path)
+{
+	if (!Recorder)
+	{
+		return false;
+	}
+	if (!Recorder->SaveAsync(Path))
+	{
+		UE_LOG(LogBodycam, Warning, TEXT("Bodycam recording not saved: nothing recorded yet, or a save is still running"));
+		return false;
+	}
+	return true;
+}
+
+void UBodycamReplaySubsystem::StopRecording(const FString& Path)
+{
+	if (Recorder)
+	{
+		SaveRecording(Path);
+		Recorder.Reset();
+	}
+	RecordedPawn.Reset();
+}
+
+bool UBodycamReplaySubsystem::StartPlayback(ABodycamCharacter* Pawn, TArray<FBodycamRecordFrame>&& Frames)
+{
+	if (!Pawn || Frames.Num() == 0)
+	{
+		UE_LOG(LogBodycam, Warning, TEXT("Bodycam playback needs a pawn and a non-empty recording"));
+		return false;
+	}
+
+	StopPlayback();
+
+	PlaybackPawn = Pawn;
+	PlaybackFrames = MoveTemp(Frames);
+	PlaybackIndex = 0;
+	PoseTrack.Reset(PlaybackFrames.Num());
+	MaxDrift = 0.f;
+
+	// the file drives movement and view; live input would only fight it
+	SetPlayerInputIgnored(Pawn, true);
+	return true;
+}
+
+void UBodycamReplaySubsystem::StopPlayback()
+{
+	ABodycamCharacter* Pawn = PlaybackPawn.Get();
+	if (!Pawn)
+	{
+		PlaybackPawn.Reset();
+		return;
+	}
+
+	// pose after the last played frame
+	if (PlaybackIndex > PoseTrack.Num())
+	{
+		CapturePose();
+	}
+	SetPlayerInputIgnored(Pawn, false);
+	PlaybackPawn.Reset();
+	PlaybackFrames.Reset();
+
+	TArray<uint8> Bytes;
+	SerializePoseTrack(PoseTrack, Bytes);
+	UE_LOG(LogBodycam, Display, TEXT("Bodycam playback done: %d frames, max drift %.3f cm, pose track crc %08x"),
+		PoseTrack.Num(), MaxDrift, FCrc::MemCrc32(Bytes.GetData(), Bytes.Num()));
+}
+
+float UBodycamReplaySubsystem::GetPlaybackDeltaSeconds() const
+{
+	return PlaybackFrames.IsValidIndex(PlaybackIndex) ? PlaybackFrames[PlaybackIndex].DeltaSeconds : 0.f;
+}
+
+void UBodycamReplaySubsystem::SerializePoseTrack(const TArray<FBodycamViewPose>& Track, TArray<uint8>& OutBytes)
+{
+	FMemoryWriter Ar(OutBytes);
+	for (FBodycamViewPose Pose : Track)
+	{
+		Ar << Pose.PivotOffset.X << Pose.PivotOffset.Y << Pose.PivotOffset.Z;
+		Ar << Pose.Pitch << Pose.Roll << Pose.FOV;
+		Ar << Pose.LightLocation.X << Pose.LightLocation.Y << Pose.LightLocation.Z;
+		Ar << Pose.LightPitch << Pose.LightYaw;
+	}
+}
+
+void UBodycamReplaySubsystem::OnPreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld())
+	{
+		return;
+	}
+
+	if (ABodycamCharacter* Pawn = RecordedPawn.Get())
+	{
+		RecordFrameStart(Pawn);
+	}
+
+	if (ABodycamCharacter* Pawn = PlaybackPawn.Get())
+	{
+		if (PlaybackIndex < PlaybackFrames.Num())
+		{
+			PlayFrame(Pawn);
+		}
+		else
+		{
+			StopPlayback();
+		}
+	}
+}
+
+void UBodycamReplaySubsystem::OnPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld())
+	{
+		return;
+	}
+
+	if (ABodycamCharacter* Pawn = RecordedPawn.Get())
+	{
+		RecordFrameEnd(Pawn, DeltaSeconds);
+	}
+}
+
+void UBodycamReplaySubsystem::RecordFrameStart(ABodycamCharacter* Pawn)
+{
+	const UBodycamMotionSubsystem* Motion = GetWorld()->GetSubsystem<UBodycamMotionSubsystem>();
+	FBodycamRecordState State;
+	if (!Motion || !Motion->GetRecordState(Pawn, State))
+	{
+		return;
+	}
+
+	CurrentFrame = FBodycamRecordFrame();
+	CurrentFrame.SetState(State);
+	CurrentFrame.Location = FVector3f(Pawn->GetActorLocation());
+	CurrentFrame.SetControlRotation(Pawn->GetController() ? Pawn->GetControlRotation() : Pawn->GetActorRotation());
+	bFrameStarted = true;
+}
+
+void UBodycamReplaySubsystem::RecordFrameEnd(ABodycamCharacter* Pawn, float DeltaSeconds)
+{
+	if (!bFrameStarted || !Recorder)
+	{
+		return;
+	}
+	bFrameStarted = false;
+
+	// input the frame consumed: movement went into CharacterMovement, look was resolved by the
+	// motion update (TG_PostPhysics)
+	CurrentFrame.DeltaSeconds = DeltaSeconds;
+	CurrentFrame.SetMoveInput(Pawn->GetLastMovementInputVector());
+	CurrentFrame.SetLookInput(Pawn->GetResolvedLookInput());
+
+	const bool bJumped = Pawn->JumpCurrentCount != Pawn->JumpCurrentCountPreJump;
+	const USpotLightComponent* Light = Pawn->GetFlashlight();
+	CurrentFrame.Buttons = (Pawn->IsSprinting() ? FBodycamRecordFrame::B_Sprint : 0)
+		| ((bJumped || Pawn->bPressedJump) ? FBodycamRecordFrame::B_Jump : 0)
+		| ((Light && Light->IsVisible()) ? FBodycamRecordFrame::B_Flashlight : 0);
+
+	Recorder->Add(CurrentFrame);
+
+	// a spike we want to look at: keep the lead-up
+	const double Now = FPlatformTime::Seconds();
+	if (GBodycamRecordSpikeMs > 0.f && DeltaSeconds * 1000.f > GBodycamRecordSpikeMs
+		&& Now - LastSpikeSaveTime > BodycamReplay::SpikeSaveCooldown)
+	{
+		LastSpikeSaveTime = Now;
+		UE_LOG(LogBodycam, Display, TEXT("Frame took %.2f ms, saving the bodycam recording"), DeltaSeconds * 1000.f);
+		SaveRecording(FBodycamRecording::MakeDefaultPath(TEXT("BodycamSpike")));
+	}
+}
+
+void UBodycamReplaySubsystem::PlayFrame(ABodycamCharacter* Pawn)
+{
+	const FBodycamRecordFrame& Frame = PlaybackFrames[PlaybackIndex];
+	UBodycamMotionSubsystem* Motion = GetWorld()->GetSubsystem<UBodycamMotionSubsystem>();
+
+	if (PlaybackIndex == 0)
+	{
+		// start exactly where the recording starts
+		Pawn->SetActorLocation(FVector(Frame.Location), false, nullptr, ETeleportType::TeleportPhysics);
+		Pawn->GetCharacterMovement()->StopMovementImmediately();
+		if (Motion)
+		{
+			Motion->SetRecordState(Pawn, Frame.GetState());
+		}
+	}
+	else
+	{
+		CapturePose();
+		MaxDrift = FMath::Max(MaxDrift, (float)FVector::Dist(Pawn->GetActorLocation(), FVector(Frame.Location)));
+	}
+
+	// view comes straight from the file, the look input only feeds the flashlight free-aim
+	const FRotator ControlRot = Frame.GetControlRotation();
+	if (AController* Controller = Pawn->GetController())
+	{
+		Controller->SetControlRotation(ControlRot);
+	}
+	Pawn->FaceRotation(ControlRot, 0.f);
+
+	Pawn->AddMovementInput(Frame.GetMoveInput(), 1.f, true);
+	Pawn->AddLookInput(Frame.GetLookInput());
+
+	const bool bSprint = (Frame.Buttons & FBodycamRecordFrame::B_Sprint) != 0;
+	if (Pawn->IsSprinting() != bSprint)
+	{
+		Pawn->SetSprinting(bSprint);
+	}
+	if (Frame.Buttons & FBodycamRecordFrame::B_Jump)
+	{
+		Pawn->Jump();
+	}
+	else if (Pawn->bPressedJump)
+	{
+		Pawn->StopJumping();
+	}
+	if (USpotLightComponent* Light = Pawn->GetFlashlight())
+	{
+		Light->SetVisibility((Frame.Buttons & FBodycamRecordFrame::B_Flashlight) != 0);
+	}
+
+	++PlaybackIndex;
+}
+
+void UBodycamReplaySubsystem::CapturePose()
+{
+	const UBodycamMotionSubsystem* Motion = GetWorld()->GetSubsystem<UBodycamMotionSubsystem>();
+	const ABodycamCharacter* Pawn = PlaybackPawn.Get();
+	FBodycamViewPose Pose;
+	if (Motion && Motion->GetViewPose(Pawn, Pose))
+	{
+		// the pose is relative to wherever the pivot component sits; the track keeps it absolute
+		Pose.PivotOffset += FVector3f(Pawn->GetCameraPivot()->GetRelativeLocation());
+	}
+	PoseTrack.Add(Pose);
+}
+
+void UBodycamReplaySubsystem::SetPlayerInputIgnored(ABodycamCharacter* Pawn, bool bIgnore)
+{
+	if (APlayerController* PC = Cast<APlayerController>(Pawn->GetController()))
+	{
+		PC->SetIgnoreMoveInput(bIgnore);
+		PC->SetIgnoreLookInput(bIgnore);
+	}
+}
@@ -0,0 +1,86 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BodycamRecording.h"
+#include "BodycamMotionSubsystem.h"
+#include "BodycamReplaySubsystem.generated.h"
+
+class ABodycamCharacter;
+
+/**
+ * Records one bodycam pawn (input + motion state + transform) into a ring buffer, and plays a
+ * recording back into a pawn, in game or headless (UBodycamReplayCommandlet).
+ *
+ *   bodycam.Record.Start [Frames]   bodycam.Record.Save [Path]   bodycam.Record.Stop
+ *   bodycam.Replay.Play <Path>      bodycam.Replay.Stop
+ *
+ * Frames are built around the actor tick: state and transform before it, input after it (by
+ * then movement and the motion update have consumed it). Playback injects each frame before the actor
+ * tick and collects the resulting view pose so runs can be compared bit for bit.
+ */
+UCLASS()
+class BODYCAMHORRORGAME_API UBodycamReplaySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// recording
+	bool StartRecording(ABodycamCharacter* Pawn, int32 CapacityFrames);
+	bool SaveRecording(const FString& Path);
+	void StopRecording(const FString& Path);
+	bool IsRecording() const { return Recorder.IsValid(); }
+
+	// playback
+	bool StartPlayback(ABodycamCharacter* Pawn, TArray<FBodycamRecordFrame>&& Frames);
+	void StopPlayback();
+	bool IsPlaying() const { return PlaybackPawn.IsValid() && PlaybackIndex < PlaybackFrames.Num(); }
+
+	/** Recorded delta of the frame about to be played (headless drivers tick the world with it). */
+	float GetPlaybackDeltaSeconds() const;
+
+	/** View pose after every played frame; complete once StopPlayback has run. */
+	const TArray<FBodycamViewPose>& GetPoseTrack() const { return PoseTrack; }
+
+	/** Largest distance (cm) between the played and the recorded pawn location. */
+	float GetMaxDrift() const { return MaxDrift; }
+
+	/** Pose track as bytes, in a fixed field order (what gets hashed and compared). */
+	static void SerializePoseTrack(const TArray<FBodycamViewPose>& Track, TArray<uint8>& OutBytes);
+
+	// UWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void OnPreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+	void OnPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+	void RecordFrameStart(ABodycamCharacter* Pawn);
+	void RecordFrameEnd(ABodycamCharacter* Pawn, float DeltaSeconds);
+	void PlayFrame(ABodycamCharacter* Pawn);
+	void CapturePose();
+	void SetPlayerInputIgnored(ABodycamCharacter* Pawn, bool bIgnore);
+
+	FDelegateHandle PreActorTickHandle;
+	FDelegateHandle PostActorTickHandle;
+
+	// recording
+	TUniquePtr<FBodycamRecorder> Recorder;
+	TWeakObjectPtr<ABodycamCharacter> RecordedPawn;
+	FBodycamRecordFrame CurrentFrame;
+	bool bFrameStarted = false;
+	double LastSpikeSaveTime = 0.0;
+
+	// playback
+	TWeakObjectPtr<ABodycamCharacter> PlaybackPawn;
+	TArray<FBodycamRecordFrame> PlaybackFrames;
+	int32 PlaybackIndex = 0;
+	TArray<FBodycamViewPose> PoseTrack;
+	float MaxDrift = 0.f;
+};
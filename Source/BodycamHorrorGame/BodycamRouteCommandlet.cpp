@@ -0,0 +1,507 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamRouteCommandlet.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamBenchmarkCommandlet.h"
+#include "BodycamCameraModifier.h"
+#include "BodycamCharacter.h"
+#include "BodycamMotionSubsystem.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "EnhancedPlayerInput.h"
+#include "InputAction.h"
+#include "InputActionValue.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerStart.h"
+#include "HAL/PlatformMemory.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace BodycamRoute
+{
+	static constexpr float FixedDeltaSeconds = 1.f / 60.f;
+
+	// walk, look around, flashlight sweeps, sprint + jump, strafes, turn back, stand and look (~40 s)
+	static const TCHAR* DefaultScript = TEXT(
+		"1.0\n"
+		"4.0 move=0,1 look=20,0\n"
+		"2.0 move=0,1 look=-40,5\n"
+		"0.5 flashlight\n"
+		"3.0 move=0,1 look=60,0\n"
+		"3.0 move=0,1 look=-60,-5\n"
+		"2.0 move=0,1 sprint\n"
+		"0.5 move=0,1 sprint jump\n"
+		"2.5 move=0,1 sprint\n"
+		"2.0 move=1,0 look=0,10\n"
+		"2.0 move=-1,0 look=0,-10\n"
+		"1.5 look=120,0\n"
+		"3.0 move=0,1\n"
+		"0.5 move=0,1 jump\n"
+		"3.0 move=0,1 look=30,0\n"
+		"0.5 flashlight\n"
+		"3.0 look=-45,8\n");
+
+	// a metric regresses past Baseline * (1 + Relative) + Absolute; Absolute keeps tiny values from flapping
+	struct FRule
+	{
+		const TCHAR* Name;
+		float Relative;
+		float Absolute;
+	};
+
+	static const FRule Rules[] =
+	{
+		{ TEXT("frame_ms_mean"),       0.10f, 0.10f },
+		{ TEXT("frame_ms_p95"),        0.15f, 0.25f },
+		{ TEXT("frame_ms_max"),        0.50f, 5.f   },
+		{ TEXT("game_thread_ms_mean"), 0.10f, 0.10f },
+		{ TEXT("game_thread_ms_p95"),  0.15f, 0.25f },
+		{ TEXT("bodycam_ms_mean"),     0.15f, 0.02f },
+		{ TEXT("bodycam_ms_p95"),      0.20f, 0.05f },
+		{ TEXT("hitches"),             0.f,   2.f   },
+		{ TEXT("memory_peak_mb"),      0.05f, 32.f  },
+		{ TEXT("memory_growth_mb"),    0.f,   16.f  },
+	};
+
+	// the pass ends this close to where the baseline's did, or the script no longer drives the same route
+	static constexpr float MaxEndDrift = 50.f; // cm
+
+	static float Mean(const TArray<float>& Samples)
+	{
+		double Sum = 0.0;
+		for (float V : Samples) Sum += V;
+		return Samples.Num() > 0 ? (float)(Sum / Samples.Num()) : 0.f;
+	}
+
+	static float Percentile(TArray<float> Samples, float P)
+	{
+		if (Samples.Num() == 0)
+		{
+			return 0.f;
+		}
+		Samples.Sort();
+		return Samples[FMath::Clamp(FMath::CeilToInt(P * Samples.Num()) - 1, 0, Samples.Num() - 1)];
+	}
+
+	static float Median(TArray<float> Values)
+	{
+		return Percentile(MoveTemp(Values), 0.5f);
+	}
+
+	static float UsedPhysicalMB()
+	{
+		return (float)(FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0));
+	}
+}
+
+UBodycamRouteCommandlet::UBodycamRouteCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UBodycamRouteCommandlet::Main(const FString& Params)
+{
+	FString MapPath = TEXT("/Game/Saves/Testing");
+	FParse::Value(*Params, TEXT("Map="), MapPath);
+
+	FString ScriptText = BodycamRoute::DefaultScript;
+	FString ScriptPath;
+	if (FParse::Value(*Params, TEXT("Script="), ScriptPath) && !FFileHelper::LoadFileToString(ScriptText, *ScriptPath))
+	{
+		UE_LOG(LogBodycam, Error, TEXT("Could not load route script %s"), *ScriptPath);
+		return 1;
+	}
+	TArray<FStep> Steps;
+	if (!ParseScript(ScriptText, Steps))
+	{
+		UE_LOG(LogBodycam, Error, TEXT("Route script is empty or malformed"));
+		return 1;
+	}
+
+	int32 Runs = 3;
+	int32 WarmupFrames = 60;
+	float HitchMs = 33.3f;
+	float Tolerance = -1.f;
+	FParse::Value(*Params, TEXT("Runs="), Runs);
+	FParse::Value(*Params, TEXT("Warmup="), WarmupFrames);
+	FParse::Value(*Params, TEXT("HitchMs="), HitchMs);
+	FParse::Value(*Params, TEXT("Tolerance="), Tolerance);
+
+	FString OutDir = FPaths::ProjectSavedDir() / TEXT("Profiling/Bodycam");
+	FParse::Value(*Params, TEXT("Out="), OutDir);
+
+	TArray<FRun> Results;
+	for (int32 Run = 0; Run < FMath::Max(1, Runs); ++Run)
+	{
+		FRun& Result = Results.AddDefaulted_GetRef();
+		if (!RunOnce(MapPath, Steps, WarmupFrames, HitchMs, OutDir, Result))
+		{
+			UE_LOG(LogBodycam, Error, TEXT("Could not run the route on %s"), *MapPath);
+			return 1;
+		}
+		UE_LOG(LogBodycam, Display, TEXT("Run %d: %d frames | frame mean %.3f ms p95 %.3f | game thread mean %.3f ms | bodycam mean %.3f ms | hitches %d | mem peak %.0f MB (+%.1f) -> %s"),
+			Run, Result.FrameMs.Num(), BodycamRoute::Mean(Result.FrameMs), BodycamRoute::Percentile(Result.FrameMs, 0.95f),
+			BodycamRoute::Mean(Result.GameThreadMs), BodycamRoute::Mean(Result.BodycamMs), Result.Hitches,
+			Result.MemoryPeakMB, Result.MemoryGrowthMB, *Result.CsvPath);
+	}
+
+	const TSharedRef<FJsonObject> Summary = Summarize(Results);
+	Summary->SetStringField(TEXT("map"), MapPath);
+	Summary->SetStringField(TEXT("script"), ScriptPath.IsEmpty() ? TEXT("default") : FPaths::GetCleanFilename(ScriptPath));
+
+	FString Json;
+	FJsonSerializer::Serialize(Summary, TJsonWriterFactory<>::Create(&Json));
+	const FString JsonPath = OutDir / FString::Printf(TEXT("BodycamRoute-%s.json"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")));
+	FFileHelper::SaveStringToFile(Json, *JsonPath);
+	UE_LOG(LogBodycam, Display, TEXT("Route summary written to %s"), *JsonPath);
+
+	// the summary is a valid baseline as is
+	FString WriteBaselinePath;
+	if (FParse::Value(*Params, TEXT("WriteBaseline="), WriteBaselinePath))
+	{
+		FFileHelper::SaveStringToFile(Json, *WriteBaselinePath);
+		UE_LOG(LogBodycam, Display, TEXT("Baseline written to %s"), *WriteBaselinePath);
+	}
+
+	FString BaselinePath;
+	if (!FParse::Value(*Params, TEXT("Baseline="), BaselinePath))
+	{
+		return 0;
+	}
+
+	FString BaselineText;
+	TSharedPtr<FJsonObject> Baseline;
+	if (!FFileHelper::LoadFileToString(BaselineText, *BaselinePath)
+		|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineText), Baseline) || !Baseline.IsValid())
+	{
+		UE_LOG(LogBodycam, Error, TEXT("Could not load baseline %s"), *BaselinePath);
+		return 1;
+	}
+
+	const bool bPassed = CompareToBaseline(*Summary, *Baseline, Tolerance);
+	UE_LOG(LogBodycam, Display, TEXT("Bodycam route %s against %s"), bPassed ? TEXT("passed") : TEXT("REGRESSED"), *BaselinePath);
+	return bPassed ? 0 : 1;
+}
+
+bool UBodycamRouteCommandlet::ParseScript(const FString& Text, TArray<FStep>& OutSteps)
+{
+	TArray<FString> Lines;
+	Text.ParseIntoArrayLines(Lines);
+	for (FString Line : Lines)
+	{
+		int32 Comment;
+		if (Line.FindChar(TEXT('#'), Comment))
+		{
+			Line.LeftInline(Comment);
+		}
+
+		TArray<FString> Tokens;
+		Line.ParseIntoArrayWS(Tokens);
+		if (Tokens.Num() == 0)
+		{
+			continue;
+		}
+
+		FStep& Step = OutSteps.AddDefaulted_GetRef();
+		Step.Seconds = FCString::Atof(*Tokens[0]);
+		if (Step.Seconds <= 0.f)
+		{
+			return false;
+		}
+
+		for (int32 i = 1; i < Tokens.Num(); ++i)
+		{
+			FString Key, Value, X, Y;
+			if (Tokens[i].Split(TEXT("="), &Key, &Value))
+			{
+				if (!Value.Split(TEXT(","), &X, &Y))
+				{
+					return false;
+				}
+				const FVector2D Axis(FCString::Atof(*X), FCString::Atof(*Y));
+				if      (Key == TEXT("move")) Step.Move = Axis;
+				else if (Key == TEXT("look")) Step.Look = Axis;
+				else return false;
+			}
+			else if (Tokens[i] == TEXT("sprint"))     Step.bSprint = true;
+			else if (Tokens[i] == TEXT("jump"))       Step.bJump = true;
+			else if (Tokens[i] == TEXT("flashlight")) Step.bFlashlight = true;
+			else return false;
+		}
+	}
+	return OutSteps.Num() > 0;
+}
+
+bool UBodycamRouteCommandlet::RunOnce(const FString& MapPath, const TArray<FStep>& Steps, int32 WarmupFrames, float HitchMs, const FString& OutDir, FRun& OutRun)
+{
+	UClass* PawnClass = LoadClass<ABodycamCharacter>(nullptr, TEXT("/Game/BP/BP_BodycamCharacter.BP_BodycamCharacter_C"));
+	if (!PawnClass)
+	{
+		UE_LOG(LogBodycam, Error, TEXT("BP_BodycamCharacter could not be loaded (the native class has no input actions)"));
+		return false;
+	}
+
+	UWorld* World = UBodycamBenchmarkCommandlet::LoadMapWorld(MapPath);
+	if (!World)
+	{
+		return false;
+	}
+
+	FTransform Start(FVector(0.f, 0.f, 200.f));
+	for (TActorIterator<APlayerStart> It(World); It; ++It)
+	{
+		Start = It->GetActorTransform();
+		break;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	APlayerController* PC = World->SpawnActor<APlayerController>(APlayerController::StaticClass(), Start, SpawnParams);
+	ABodycamCharacter* Pawn = World->SpawnActor<ABodycamCharacter>(PawnClass, Start, SpawnParams);
+	if (!PC || !Pawn)
+	{
+		UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+		return false;
+	}
+
+	// no local player here: make the enhanced player input ourselves and have the actions loaded
+	// before possession, so SetupPlayerInputComponent binds them right away
+	PC->InitInputSystem();
+	TArray<FSoftObjectPath> InputAssets;
+	Pawn->GatherInputAssets(InputAssets);
+	for (const FSoftObjectPath& Path : InputAssets)
+	{
+		Path.TryLoad();
+	}
+	PC->Possess(Pawn);
+	PC->SetControlRotation(Start.Rotator());
+	UBodycamCameraModifier::AddTo(PC);
+
+	UEnhancedPlayerInput* Input = Cast<UEnhancedPlayerInput>(PC->PlayerInput);
+	const UInputAction* MoveAction = Pawn->GetMoveAction().Get();
+	const UInputAction* LookAction = Pawn->GetLookAction().Get();
+	const UInputAction* JumpAction = Pawn->GetJumpAction().Get();
+	const UInputAction* SprintAction = Pawn->GetSprintAction().Get();
+	const UInputAction* FlashlightAction = Pawn->GetFlashlightAction().Get();
+	if (!Input || !MoveAction || !LookAction || !JumpAction || !SprintAction || !FlashlightAction)
+	{
+		UE_LOG(LogBodycam, Error, TEXT("No enhanced player input or missing input actions on %s"), *PawnClass->GetName());
+		UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+		return false;
+	}
+
+	// everything around the start is in before the clock starts, so runs begin alike
+	World->BlockTillLevelStreamingCompleted();
+
+	const float Dt = BodycamRoute::FixedDeltaSeconds;
+	for (int32 Frame = 0; Frame < WarmupFrames; ++Frame)
+	{
+		World->Tick(LEVELTICK_All, Dt);
+		StaticTick(Dt, true);
+		++GFrameCounter;
+	}
+
+	const UBodycamMotionSubsystem* Motion = World->GetSubsystem<UBodycamMotionSubsystem>();
+	const float StartMemoryMB = BodycamRoute::UsedPhysicalMB();
+	OutRun.MemoryPeakMB = StartMemoryMB;
+
+#if CSV_PROFILER
+	const FString CsvName = FString::Printf(TEXT("BodycamRoute-%s.csv"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S-%s")));
+	FCsvProfiler::Get()->BeginCapture(-1, OutDir, CsvName);
+	OutRun.CsvPath = OutDir / CsvName;
+#endif
+
+	for (const FStep& Step : Steps)
+	{
+		const int32 StepFrames = FMath::Max(1, FMath::RoundToInt(Step.Seconds / Dt));
+		for (int32 StepFrame = 0; StepFrame < StepFrames; ++StepFrame)
+		{
+			// no engine loop here, so the CSV profiler's frames are ours to mark
+#if CSV_PROFILER
+			FCsvProfiler::Get()->BeginFrame();
+#endif
+			const double FrameStart = FPlatformTime::Seconds();
+
+			// held inputs every frame, presses on the first one (the action completes when we stop)
+			if (!Step.Move.IsZero())
+			{
+				Input->InjectInputForAction(MoveAction, FInputActionValue(Step.Move));
+			}
+			if (!Step.Look.IsZero())
+			{
+				Input->InjectInputForAction(LookAction, FInputActionValue(Step.Look * Dt));
+			}
+			if (Step.bSprint)
+			{
+				Input->InjectInputForAction(SprintAction, FInputActionValue(true));
+			}
+			if (StepFrame == 0 && Step.bJump)
+			{
+				Input->InjectInputForAction(JumpAction, FInputActionValue(true));
+			}
+			if (StepFrame == 0 && Step.bFlashlight)
+			{
+				Input->InjectInputForAction(FlashlightAction, FInputActionValue(true));
+			}
+
+			const double TickStart = FPlatformTime::Seconds();
+			World->Tick(LEVELTICK_All, Dt);
+			const double TickEnd = FPlatformTime::Seconds();
+			StaticTick(Dt, true);
+			++GFrameCounter;
+			const double FrameEnd = FPlatformTime::Seconds();
+
+			const float FrameMs = (float)((FrameEnd - FrameStart) * 1000.0);
+			const float GameThreadMs = (float)((TickEnd - TickStart) * 1000.0);
+			const float BodycamMs = Motion ? (float)(Motion->GetLastTimings().GetTotalSeconds() * 1000.0) : 0.f;
+			const float MemoryMB = BodycamRoute::UsedPhysicalMB();
+			const bool bHitch = FrameMs > HitchMs;
+
+			OutRun.FrameMs.Add(FrameMs);
+			OutRun.GameThreadMs.Add(GameThreadMs);
+			OutRun.BodycamMs.Add(BodycamMs);
+			OutRun.Hitches += bHitch ? 1 : 0;
+			OutRun.MemoryPeakMB = FMath::Max(OutRun.MemoryPeakMB, MemoryMB);
+
+			CSV_CUSTOM_STAT(Bodycam, RouteFrameTime, FrameMs, ECsvCustomStatOp::Set);
+			CSV_CUSTOM_STAT(Bodycam, RouteGameThreadTime, GameThreadMs, ECsvCustomStatOp::Set);
+			CSV_CUSTOM_STAT(Bodycam, RouteBodycamTime, BodycamMs, ECsvCustomStatOp::Set);
+			CSV_CUSTOM_STAT(Bodycam, RouteHitch, bHitch ? 1 : 0, ECsvCustomStatOp::Set);
+			CSV_CUSTOM_STAT(Bodycam, RoutePhysicalUsedMB, MemoryMB, ECsvCustomStatOp::Set);
+#if CSV_PROFILER
+			FCsvProfiler::Get()->EndFrame();
+#endif
+		}
+	}
+
+#if CSV_PROFILER
+	// the end is picked up on the next frame boundary; then wait for the file
+	TSharedFuture<FString> CsvFile = FCsvProfiler::Get()->EndCapture();
+	FCsvProfiler::Get()->BeginFrame();
+	FCsvProfiler::Get()->EndFrame();
+	CsvFile.Wait();
+#endif
+
+	OutRun.MemoryGrowthMB = BodycamRoute::UsedPhysicalMB() - StartMemoryMB;
+	OutRun.EndLocation = Pawn->GetActorLocation();
+
+	UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+	return OutRun.FrameMs.Num() > 0;
+}
+
+TSharedRef<FJsonObject> UBodycamRouteCommandlet::Summarize(const TArray<FRun>& Runs)
+{
+	using namespace BodycamRoute;
+
+	TMap<FString, TArray<float>> PerRun;
+	TArray<FVector> EndLocations;
+	for (const FRun& Run : Runs)
+	{
+		PerRun.FindOrAdd(TEXT("frame_ms_mean")).Add(Mean(Run.FrameMs));
+		PerRun.FindOrAdd(TEXT("frame_ms_p95")).Add(Percentile(Run.FrameMs, 0.95f));
+		PerRun.FindOrAdd(TEXT("frame_ms_max")).Add(Percentile(Run.FrameMs, 1.f));
+		PerRun.FindOrAdd(TEXT("game_thread_ms_mean")).Add(Mean(Run.GameThreadMs));
+		PerRun.FindOrAdd(TEXT("game_thread_ms_p95")).Add(Percentile(Run.GameThreadMs, 0.95f));
+		PerRun.FindOrAdd(TEXT("bodycam_ms_mean")).Add(Mean(Run.BodycamMs));
+		PerRun.FindOrAdd(TEXT("bodycam_ms_p95")).Add(Percentile(Run.BodycamMs, 0.95f));
+		PerRun.FindOrAdd(TEXT("hitches")).Add((float)Run.Hitches);
+		PerRun.FindOrAdd(TEXT("memory_peak_mb")).Add(Run.MemoryPeakMB);
+		PerRun.FindOrAdd(TEXT("memory_growth_mb")).Add(Run.MemoryGrowthMB);
+		EndLocations.Add(Run.EndLocation);
+	}
+
+	TSharedRef<FJsonObject> Metrics = MakeShared<FJsonObject>();
+	for (const TPair<FString, TArray<float>>& Metric : PerRun)
+	{
+		Metrics->SetNumberField(Metric.Key, Median(Metric.Value));
+	}
+
+	// fixed step and the same input: every run should end in the same place
+	const FVector End = EndLocations.Num() > 0 ? EndLocations[0] : FVector::ZeroVector;
+	for (const FVector& Other : EndLocations)
+	{
+		if (!Other.Equals(End, 1.f))
+		{
+			UE_LOG(LogBodycam, Warning, TEXT("Runs ended %.1f cm apart; the route is not deterministic"), FVector::Dist(Other, End));
+		}
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("fixed_delta_seconds"), FixedDeltaSeconds);
+	Root->SetNumberField(TEXT("runs"), Runs.Num());
+	Root->SetNumberField(TEXT("frames"), Runs.Num() > 0 ? Runs[0].FrameMs.Num() : 0);
+	Root->SetObjectField(TEXT("metrics"), Metrics);
+	TArray<TSharedPtr<FJsonValue>> EndValues;
+	EndValues.Add(MakeShared<FJsonValueNumber>(End.X));
+	EndValues.Add(MakeShared<FJsonValueNumber>(End.Y));
+	EndValues.Add(MakeShared<FJsonValueNumber>(End.Z));
+	Root->SetArrayField(TEXT("end_location"), EndValues);
+	return Root;
+}
+
+bool UBodycamRouteCommandlet::CompareToBaseline(const FJsonObject& Current, const FJsonObject& Baseline, float ToleranceOverride)
+{
+	using namespace BodycamRoute;
+
+	const TSharedPtr<FJsonObject>* CurrentMetrics = nullptr;
+	const TSharedPtr<FJsonObject>* BaselineMetrics = nullptr;
+	if (!Current.TryGetObjectField(TEXT("metrics"), CurrentMetrics) || !Baseline.TryGetObjectField(TEXT("metrics"), BaselineMetrics))
+	{
+		UE_LOG(LogBodycam, Error, TEXT("Baseline has no metrics"));
+		return false;
+	}
+
+	// a baseline may carry its own relative tolerances ("tolerance": { "frame_ms_p95": 0.3 })
+	const TSharedPtr<FJsonObject>* Tolerances = nullptr;
+	Baseline.TryGetObjectField(TEXT("tolerance"), Tolerances);
+
+	bool bPassed = true;
+	for (const FRule& Rule : Rules)
+	{
+		double Base = 0.0, Value = 0.0;
+		if (!(*BaselineMetrics)->TryGetNumberField(Rule.Name, Base) || !(*CurrentMetrics)->TryGetNumberField(Rule.Name, Value))
+		{
+			continue;
+		}
+
+		double Relative = Rule.Relative;
+		if (Tolerances)
+		{
+			(*Tolerances)->TryGetNumberField(Rule.Name, Relative);
+		}
+		if (ToleranceOverride >= 0.f)
+		{
+			Relative = ToleranceOverride;
+		}
+
+		const double Allowed = Base * (1.0 + Relative) + Rule.Absolute;
+		const bool bRegressed = Value > Allowed;
+		bPassed &= !bRegressed;
+		UE_LOG(LogBodycam, Display, TEXT("%-20s %10.3f  baseline %10.3f  allowed %10.3f  %s"),
+			Rule.Name, Value, Base, Allowed, bRegressed ? TEXT("REGRESSED") : TEXT("ok"));
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* CurrentEnd = nullptr;
+	const TArray<TSharedPtr<FJsonValue>>* BaselineEnd = nullptr;
+	if (Current.TryGetArrayField(TEXT("end_location"), CurrentEnd) && Baseline.TryGetArrayField(TEXT("end_location"), BaselineEnd)
+		&& CurrentEnd->Num() == 3 && BaselineEnd->Num() == 3)
+	{
+		const FVector A((*CurrentEnd)[0]->AsNumber(), (*CurrentEnd)[1]->AsNumber(), (*CurrentEnd)[2]->AsNumber());
+		const FVector B((*BaselineEnd)[0]->AsNumber(), (*BaselineEnd)[1]->AsNumber(), (*BaselineEnd)[2]->AsNumber());
+		const float Drift = FVector::Dist(A, B);
+		if (Drift > MaxEndDrift)
+		{
+			UE_LOG(LogBodycam, Error, TEXT("The route ended %.0f cm from the baseline's end; the script or the level changed, re-record the baseline"), Drift);
+			bPassed = false;
+		}
+	}
+	return bPassed;
+}
@@ -0,0 +1,74 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BodycamRouteCommandlet.generated.h"
+
+class FJsonObject;
+
+/**
+ * End-to-end gameplay regression run: a scripted pass through a real map, played through
+ * Enhanced Input, timed, and checked against a stored baseline.
+ *
+ *   UnrealEditor-Cmd BodycamHorrorGame -run=BodycamRoute -nullrhi -unattended
+ *       [-Map=/Game/Saves/Testing] [-Script=<file>] [-Runs=3] [-Warmup=60] [-HitchMs=33.3]
+ *       [-Baseline=<json>] [-Tolerance=<fraction>] [-WriteBaseline=<json>] [-Out=<dir>]
+ *
+ * Loads the map, possesses BP_BodycamCharacter at the player start and injects the script into
+ * MoveAction / LookAction / JumpAction / SprintAction / FlashlightAction at a fixed 60 Hz step,
+ * so every run makes the same pass. Each run is captured with the CSV profiler (frame time,
+ * game thread time, hitches, memory and the Bodycam/* scopes) to Saved/Profiling/Bodycam,
+ * next to a JSON summary. With -Baseline, the median of the runs is compared per metric and
+ * the commandlet returns 1 if any metric is worse than the baseline allows.
+ *
+ * Script lines: <seconds> [move=X,Y] [look=X,Y] [sprint] [jump] [flashlight], # comments.
+ * move is the MoveAction value (X right, Y forward), look is LookAction units per second,
+ * sprint is held for the line, jump and flashlight are pressed on its first frame.
+ */
+UCLASS()
+class UBodycamRouteCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBodycamRouteCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	/** One line of the input script. */
+	struct FStep
+	{
+		float Seconds = 0.f;
+		FVector2D Move = FVector2D::ZeroVector;
+		FVector2D Look = FVector2D::ZeroVector;
+		bool bSprint = false;
+		bool bJump = false;
+		bool bFlashlight = false;
+	};
+
+	/** Per-frame samples of one run. */
+	struct FRun
+	{
+		TArray<float> FrameMs;
+		TArray<float> GameThreadMs;
+		TArray<float> BodycamMs;
+		int32 Hitches = 0;
+		float MemoryPeakMB = 0.f;
+		float MemoryGrowthMB = 0.f;
+		FVector EndLocation = FVector::ZeroVector;
+		FString CsvPath;
+	};
+
+	static bool ParseScript(const FString& Text, TArray<FStep>& OutSteps);
+
+private:
+	bool RunOnce(const FString& MapPath, const TArray<FStep>& Steps, int32 WarmupFrames, float HitchMs, const FString& OutDir, FRun& OutRun);
+
+	/** Median of every metric over the runs. */
+	static TSharedRef<FJsonObject> Summarize(const TArray<FRun>& Runs);
+
+	/** Logs every metric against the baseline; false if any regressed beyond its tolerance. */
+	static bool CompareToBaseline(const FJsonObject& Current, const FJsonObject& Baseline, float ToleranceOverride);
+};
@@ -0,0 +1,135 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamSignificance.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+static bool GBodycamSignificanceEnable = true;
+static FAutoConsoleVariableRef CVarBodycamSignificanceEnable(
+	TEXT("bodycam.Significance.Enable"),
+	GBodycamSignificanceEnable,
+	TEXT("Rate bodycam pawns by distance / visibility and cut motion and flashlight cost for the less significant ones."));
+
+static float GBodycamSignificanceNearDistance = 2000.f;
+static FAutoConsoleVariableRef CVarBodycamSignificanceNearDistance(
+	TEXT("bodycam.Significance.NearDistance"),
+	GBodycamSignificanceNearDistance,
+	TEXT("Pawns closer than this (cm) to a view are fully significant."));
+
+static float GBodycamSignificanceFarDistance = 5000.f;
+static FAutoConsoleVariableRef CVarBodycamSignificanceFarDistance(
+	TEXT("bodycam.Significance.FarDistance"),
+	GBodycamSignificanceFarDistance,
+	TEXT("Beyond this (cm) pawns drop breathing, bob, sway and flashlight shadows."));
+
+static float GBodycamSignificanceDormantDistance = 8000.f;
+static FAutoConsoleVariableRef CVarBodycamSignificanceDormantDistance(
+	TEXT("bodycam.Significance.DormantDistance"),
+	GBodycamSignificanceDormantDistance,
+	TEXT("Beyond this (cm) pawns stop stepping their bodycam motion."));
+
+static float GBodycamSignificanceHiddenScale = 1.6f;
+static FAutoConsoleVariableRef CVarBodycamSignificanceHiddenScale(
+	TEXT("bodycam.Significance.HiddenScale"),
+	GBodycamSignificanceHiddenScale,
+	TEXT("Pawns outside every view count as this many times farther away."));
+
+static float GBodycamSignificanceLowRate = 5.f;
+static FAutoConsoleVariableRef CVarBodycamSignificanceLowRate(
+	TEXT("bodycam.Significance.LowRate"),
+	GBodycamSignificanceLowRate,
+	TEXT("Bodycam updates per second for far pawns."));
+
+static float GBodycamSignificanceFadeSeconds = 0.35f;
+static FAutoConsoleVariableRef CVarBodycamSignificanceFadeSeconds(
+	TEXT("bodycam.Significance.FadeSeconds"),
+	GBodycamSignificanceFadeSeconds,
+	TEXT("Breathing, bob and sway fade in / out over this long when a pawn changes significance."));
+
+namespace BodycamSignificance
+{
+	// the view cone is widened by this much so pawns at the screen edge still count as visible
+	static constexpr float ViewConeMarginDeg = 15.f;
+
+	void GetViews(const UWorld& World, FBodycamSignificance::FViews& OutViews)
+	{
+		for (FConstPlayerControllerIterator It = World.GetPlayerControllerIterator(); It; ++It)
+		{
+			const APlayerController* PC = It->Get();
+			if (PC && PC->IsLocalController() && PC->PlayerCameraManager)
+			{
+				const APlayerCameraManager* Camera = PC->PlayerCameraManager;
+				FBodycamSignificance::FView& View = OutViews.AddDefaulted_GetRef();
+				View.Location = Camera->GetCameraLocation();
+				View.Direction = Camera->GetCameraRotation().Vector();
+				View.CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Min(180.f, Camera->GetFOVAngle() * 0.5f + ViewConeMarginDeg)));
+			}
+		}
+	}
+}
+
+FBodycamSignificance FBodycamSignificance::FromConsole()
+{
+	FBodycamSignificance S;
+	S.bEnabled            = GBodycamSignificanceEnable;
+	S.NearDistance        = GBodycamSignificanceNearDistance;
+	S.FarDistance         = FMath::Max(S.NearDistance, GBodycamSignificanceFarDistance);
+	S.DormantDistance     = FMath::Max(S.FarDistance, GBodycamSignificanceDormantDistance);
+	S.HiddenDistanceScale = FMath::Max(1.f, GBodycamSignificanceHiddenScale);
+	S.LowRate             = GBodycamSignificanceLowRate;
+	S.FadeSeconds         = GBodycamSignificanceFadeSeconds;
+	return S;
+}
+
+EBodycamSignificance FBodycamSignificance::Bucket(float DistSq, float Scale) const
+{
+	if (DistSq < FMath::Square(NearDistance * Scale))    return EBodycamSignificance::High;
+	if (DistSq < FMath::Square(FarDistance * Scale))     return EBodycamSignificance::Medium;
+	if (DistSq < FMath::Square(DormantDistance * Scale)) return EBodycamSignificance::Low;
+	return EBodycamSignificance::Dormant;
+}
+
+EBodycamSignificance FBodycamSignificance::Rate(const FViews& Views, const FVector& Location, bool bRecentlyRendered, EBodycamSignificance Current) const
+{
+	if (Views.Num() == 0)
+	{
+		return EBodycamSignificance::Medium;
+	}
+
+	float BestDistSq = UE_MAX_FLT;
+	for (const FView& View : Views)
+	{
+		const FVector ToPawn = Location - View.Location;
+		const float DistSq = (float)ToPawn.SizeSquared();
+		const bool bInCone = FVector::DotProduct(ToPawn, View.Direction) >= View.CosHalfAngle * FMath::Sqrt(DistSq);
+		BestDistSq = FMath::Min(BestDistSq, (bInCone || bRecentlyRendered) ? DistSq : DistSq * FMath::Square(HiddenDistanceScale));
+	}
+
+	// going up is immediate, going down only once clearly past the threshold
+	const EBodycamSignificance Plain = Bucket(BestDistSq, 1.f);
+	if (Plain <= Current)
+	{
+		return Plain;
+	}
+	return FMath::Max(Bucket(BestDistSq, 1.f + Hysteresis), Current);
+}
+
+float FBodycamSignificance::GetStepRate(EBodycamSignificance Significance, float UnviewedRate) const
+{
+	switch (Significance)
+	{
+	case EBodycamSignificance::Viewed:
+	case EBodycamSignificance::High:
+		return -1.f;
+	case EBodycamSignificance::Medium:
+		return UnviewedRate;
+	case EBodycamSignificance::Low:
+		// never faster than the unviewed rate, and frozen when that is
+		return UnviewedRate < 0.f ? LowRate : FMath::Min(LowRate, UnviewedRate);
+	default:
+		return 0.f;
+	}
+}
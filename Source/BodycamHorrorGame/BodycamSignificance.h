@@ -0,0 +1,72 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+
+/** How much a bodycam pawn matters to the local views; each step down is cheaper. */
+enum class EBodycamSignificance : uint8
+{
+	Viewed,   // someone looks through it: every frame, everything
+	High,     // close: every frame, full motion, full light
+	Medium,   // mid range: bodycam.Motion.UnviewedRate, full motion, no volumetric shadow
+	Low,      // far: LowRate, no breathing / bob / sway, no shadows
+	Dormant,  // far and off-screen: not stepped, no shadows
+};
+
+/**
+ * Rates pawns against the local views, the way a significance manager would: distance to the
+ * nearest view, with pawns outside every view cone (and not drawn recently) counted as
+ * HiddenDistanceScale times farther. Demotion waits until the pawn is Hysteresis past the
+ * threshold so pawns on an edge do not flip every frame. World-free apart from GetViews.
+ *
+ * What each level turns off is faded (FadeSeconds) rather than cut, and a pawn that goes up
+ * resumes with a normal step instead of catching up, so nothing pops when it matters again.
+ */
+struct BODYCAMHORRORGAME_API FBodycamSignificance
+{
+	struct FView
+	{
+		FVector Location = FVector::ZeroVector;
+		FVector Direction = FVector::ForwardVector;
+		float CosHalfAngle = 0.f; // view cone with a margin
+	};
+	using FViews = TArray<FView, TInlineAllocator<4>>;
+
+	bool  bEnabled = true;
+	float NearDistance = 2000.f;    // cm
+	float FarDistance = 5000.f;
+	float DormantDistance = 8000.f;
+	float HiddenDistanceScale = 1.6f;
+	float Hysteresis = 0.1f;        // fraction of the threshold
+	float LowRate = 5.f;            // Hz
+	float FadeSeconds = 0.35f;
+
+	/** Current bodycam.Significance.* values. */
+	static FBodycamSignificance FromConsole();
+
+	/** No views (server, headless): Medium, i.e. the plain unviewed behaviour. */
+	EBodycamSignificance Rate(const FViews& Views, const FVector& Location, bool bRecentlyRendered, EBodycamSignificance Current) const;
+
+	/** Motion updates per second for a pawn nobody views through (< 0 = every frame, 0 = frozen). */
+	float GetStepRate(EBodycamSignificance Significance, float UnviewedRate) const;
+
+	/** Breathing, bob, strafe roll and flashlight sway run (and fade back in) at this level. */
+	static bool HasDetail(EBodycamSignificance Significance) { return Significance <= EBodycamSignificance::Medium; }
+
+	/** Fewest flashlight steps (UBodycamFlashlightGovernor) at this level: 1 = no shadows. */
+	static int32 GetLightSteps(EBodycamSignificance Significance) { return Significance >= EBodycamSignificance::Low ? 1 : 0; }
+
+	static bool KeepsVolumetricShadow(EBodycamSignificance Significance) { return Significance <= EBodycamSignificance::High; }
+
+private:
+	EBodycamSignificance Bucket(float DistSq, float Scale) const;
+};
+
+namespace BodycamSignificance
+{
+	/** Camera of every local player controller. */
+	BODYCAMHORRORGAME_API void GetViews(const UWorld& World, FBodycamSignificance::FViews& OutViews);
+}
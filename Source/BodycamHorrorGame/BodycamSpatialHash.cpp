@@ -0,0 +1,112 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamSpatialHash.h"
+
+FBodycamSpatialHash::FBodycamSpatialHash(float InCellSize)
+	: CellSize(FMath::Max(1.f, InCellSize))
+	, InvCellSize(1.f / FMath::Max(1.f, InCellSize))
+{
+}
+
+FIntVector FBodycamSpatialHash::GetCell(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt(Location.X * InvCellSize),
+		FMath::FloorToInt(Location.Y * InvCellSize),
+		FMath::FloorToInt(Location.Z * InvCellSize));
+}
+
+void FBodycamSpatialHash::AddToCell(const FIntVector& Cell, int32 Index)
+{
+	Cells.FindOrAdd(Cell).Add(Index);
+}
+
+void FBodycamSpatialHash::RemoveFromCell(const FIntVector& Cell, int32 Index)
+{
+	if (TArray<int32>* Elements = Cells.Find(Cell))
+	{
+		Elements->RemoveSingleSwap(Index, EAllowShrinking::No);
+		if (Elements->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+int32 FBodycamSpatialHash::Add(const FVector& Location)
+{
+	const int32 Index = ElementCell.Add(GetCell(Location));
+	AddToCell(ElementCell[Index], Index);
+	return Index;
+}
+
+void FBodycamSpatialHash::RemoveAtSwap(int32 Index)
+{
+	if (!ElementCell.IsValidIndex(Index))
+	{
+		return;
+	}
+	RemoveFromCell(ElementCell[Index], Index);
+
+	// the last element takes the freed index
+	const int32 Last = ElementCell.Num() - 1;
+	if (Index != Last)
+	{
+		TArray<int32>& LastCell = Cells.FindChecked(ElementCell[Last]);
+		LastCell[LastCell.IndexOfByKey(Last)] = Index;
+	}
+	ElementCell.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void FBodycamSpatialHash::Update(int32 Index, const FVector& Location)
+{
+	const FIntVector Cell = GetCell(Location);
+	if (Cell != ElementCell[Index])
+	{
+		RemoveFromCell(ElementCell[Index], Index);
+		AddToCell(Cell, Index);
+		ElementCell[Index] = Cell;
+	}
+}
+
+void FBodycamSpatialHash::Query(const FBox& Box, TArray<int32>& OutIndices) const
+{
+	const FIntVector Min = GetCell(Box.Min);
+	const FIntVector Max = GetCell(Box.Max);
+	const int64 NumBoxCells = int64(Max.X - Min.X + 1) * (Max.Y - Min.Y + 1) * (Max.Z - Min.Z + 1);
+
+	// a box wider than the occupied grid: walk the occupied cells instead
+	if (NumBoxCells > Cells.Num())
+	{
+		for (const TPair<FIntVector, TArray<int32>>& Pair : Cells)
+		{
+			const FIntVector& C = Pair.Key;
+			if (C.X >= Min.X && C.X <= Max.X && C.Y >= Min.Y && C.Y <= Max.Y && C.Z >= Min.Z && C.Z <= Max.Z)
+			{
+				OutIndices.Append(Pair.Value);
+			}
+		}
+		return;
+	}
+
+	for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			for (int32 X = Min.X; X <= Max.X; ++X)
+			{
+				if (const TArray<int32>* Elements = Cells.Find(FIntVector(X, Y, Z)))
+				{
+					OutIndices.Append(*Elements);
+				}
+			}
+		}
+	}
+}
+
+void FBodycamSpatialHash::Reset()
+{
+	ElementCell.Reset();
+	Cells.Reset();
+}
@@ -0,0 +1,40 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Uniform grid of points, updated incrementally. Elements are dense indices that mirror the
+ * owner's arrays: Add appends, RemoveAtSwap moves the last element into the freed slot, the
+ * same way the owner's TArray::RemoveAtSwap does. Every element lives in exactly one cell, so
+ * a query never returns an element twice.
+ */
+struct BODYCAMHORRORGAME_API FBodycamSpatialHash
+{
+	explicit FBodycamSpatialHash(float InCellSize = 800.f);
+
+	int32 Add(const FVector& Location);
+	void RemoveAtSwap(int32 Index);
+
+	/** Cheap when the element stays in its cell (the common case). */
+	void Update(int32 Index, const FVector& Location);
+
+	/** Appends every element whose cell overlaps the box. */
+	void Query(const FBox& Box, TArray<int32>& OutIndices) const;
+
+	void Reset();
+	int32 Num() const { return ElementCell.Num(); }
+	int32 GetNumCells() const { return Cells.Num(); }
+	float GetCellSize() const { return CellSize; }
+
+private:
+	FIntVector GetCell(const FVector& Location) const;
+	void AddToCell(const FIntVector& Cell, int32 Index);
+	void RemoveFromCell(const FIntVector& Cell, int32 Index);
+
+	float CellSize;
+	float InvCellSize;
+	TArray<FIntVector> ElementCell;
+	TMap<FIntVector, TArray<int32>> Cells;
+};
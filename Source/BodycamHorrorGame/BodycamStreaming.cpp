@@ -0,0 +1,120 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamStreaming.h"
+#include "BodycamHorrorGame.h"
+#include "WorldPartition/WorldPartitionRuntimeCell.h"
+#include "WorldPartition/WorldPartitionStreamingSource.h"
+#include "WorldPartition/WorldPartitionSubsystem.h"
+#include "HAL/IConsoleManager.h"
+
+static int32 GBodycamStreamingPredict = 1;
+static FAutoConsoleVariableRef CVarBodycamStreamingPredict(
+	TEXT("bodycam.Streaming.Predict"),
+	GBodycamStreamingPredict,
+	TEXT("Locally controlled bodycam pawns add low priority World Partition streaming shapes ahead of themselves."));
+
+static float GBodycamStreamingLookAhead = 4.f;
+static FAutoConsoleVariableRef CVarBodycamStreamingLookAhead(
+	TEXT("bodycam.Streaming.LookAheadSeconds"),
+	GBodycamStreamingLookAhead,
+	TEXT("How far ahead (s at the current or sprint speed) the farthest predicted shape sits."));
+
+static float GBodycamStreamingRangeScale = 0.5f;
+static FAutoConsoleVariableRef CVarBodycamStreamingRangeScale(
+	TEXT("bodycam.Streaming.LoadingRangeScale"),
+	GBodycamStreamingRangeScale,
+	TEXT("Predicted shapes use the grid loading range scaled by this."));
+
+namespace BodycamStreaming
+{
+	static constexpr float ProbeRadius = 1000.f;     // cm around the predicted point
+	static constexpr double ProbeTimeout = 15.0;     // s; give up on a point we never reached
+}
+
+FBodycamStreamingPrediction FBodycamStreamingPrediction::FromConsole()
+{
+	FBodycamStreamingPrediction Settings;
+	Settings.bEnabled = GBodycamStreamingPredict != 0;
+	Settings.LookAheadSeconds = FMath::Max(0.f, GBodycamStreamingLookAhead);
+	Settings.LoadingRangeScale = FMath::Max(0.01f, GBodycamStreamingRangeScale);
+	return Settings;
+}
+
+int32 FBodycamStreamingPrediction::Predict(const FVector& Velocity, const FVector& Facing, bool bSprinting, float SprintSpeed, FVector (&OutOffsets)[MaxShapes]) const
+{
+	const FVector Ground(Velocity.X, Velocity.Y, 0.f);
+	float Speed = Ground.Size();
+	if (Speed < MinSpeed || LookAheadSeconds <= 0.f)
+	{
+		return 0;
+	}
+
+	// plan for top speed while still accelerating into a sprint
+	if (bSprinting)
+	{
+		Speed = FMath::Max(Speed, SprintSpeed);
+	}
+
+	// lean toward the camera; looking straight back (backpedalling) keeps the velocity direction
+	const FVector MoveDir = Ground / Ground.Size();
+	FVector Dir = MoveDir;
+	const FVector FaceDir = Facing.GetSafeNormal2D();
+	if (!FaceDir.IsNearlyZero())
+	{
+		const FVector Blend = MoveDir * (1.f - FacingWeight) + FaceDir * FacingWeight;
+		if (!Blend.IsNearlyZero(0.1f))
+		{
+			Dir = Blend.GetSafeNormal2D();
+		}
+	}
+
+	const float Distance = Speed * LookAheadSeconds;
+	for (int32 s = 0; s < MaxShapes; ++s)
+	{
+		OutOffsets[s] = Dir * (Distance * (s + 1) / MaxShapes);
+	}
+	return MaxShapes;
+}
+
+bool BodycamStreaming::IsLoaded(const UWorldPartitionSubsystem& WorldPartition, const FVector& Location, float Radius, bool bActivated)
+{
+	FWorldPartitionStreamingQuerySource Query(Location);
+	Query.Radius = Radius;
+	Query.bUseGridLoadingRange = false;
+	Query.bSpatialQuery = true;
+
+	const EWorldPartitionRuntimeCellState State = bActivated ? EWorldPartitionRuntimeCellState::Activated : EWorldPartitionRuntimeCellState::Loaded;
+	return WorldPartition.IsStreamingCompleted(State, { Query }, false);
+}
+
+void FBodycamStreamingProbe::Poll(const UWorldPartitionSubsystem& WorldPartition, const FVector* PredictedLocation, double Now)
+{
+	if (bPending)
+	{
+		if (BodycamStreaming::IsLoaded(WorldPartition, Location, BodycamStreaming::ProbeRadius, false))
+		{
+			bPending = false;
+			LastLoadSeconds = Now - StartTime;
+			MaxLoadSeconds = FMath::Max(MaxLoadSeconds, LastLoadSeconds);
+			TotalLoadSeconds += LastLoadSeconds;
+			++NumLoads;
+
+			SET_FLOAT_STAT(STAT_BodycamPredictedLoadMs, (float)(LastLoadSeconds * 1000.0));
+			INC_DWORD_STAT(STAT_BodycamPredictedLoads);
+		}
+		else if (Now - StartTime > BodycamStreaming::ProbeTimeout)
+		{
+			bPending = false;
+		}
+		return;
+	}
+
+	// only points that still need loading tell us anything
+	if (PredictedLocation && !BodycamStreaming::IsLoaded(WorldPartition, *PredictedLocation, BodycamStreaming::ProbeRadius, false))
+	{
+		Location = *PredictedLocation;
+		StartTime = Now;
+		bPending = true;
+	}
+}
@@ -0,0 +1,62 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorldPartitionSubsystem;
+
+/**
+ * Where World Partition should start loading before the pawn gets there: points ahead along the
+ * ground velocity, bent toward the camera facing so a turn moves them before the velocity does.
+ * Sprinting plans with the sprint speed right away, so cells are requested while still
+ * accelerating. Kept free of the world so the projection can be checked on its own.
+ */
+struct BODYCAMHORRORGAME_API FBodycamStreamingPrediction
+{
+	static constexpr int32 MaxShapes = 2;
+
+	bool bEnabled = true;
+	float LookAheadSeconds = 4.f;
+	float FacingWeight = 0.35f;
+	float MinSpeed = 50.f;        // cm/s; slower than this predicts nothing
+	float LoadingRangeScale = 0.5f;
+
+	/** Settings from the bodycam.Streaming.* console variables. */
+	static FBodycamStreamingPrediction FromConsole();
+
+	/** Offsets from the pawn of the look-ahead points, nearest first; returns how many. */
+	int32 Predict(const FVector& Velocity, const FVector& Facing, bool bSprinting, float SprintSpeed, FVector (&OutOffsets)[MaxShapes]) const;
+};
+
+/**
+ * Time until the cells around a predicted point are loaded. Polled a few times a second: a
+ * probe starts at the farthest predicted point when it is not loaded yet and finishes when it
+ * is (or gives up after a while). Feeds the "Predicted Cell Load" stats.
+ */
+struct BODYCAMHORRORGAME_API FBodycamStreamingProbe
+{
+	/** PredictedLocation is null when nothing is predicted (standing still); Now is wall time. */
+	void Poll(const UWorldPartitionSubsystem& WorldPartition, const FVector* PredictedLocation, double Now);
+
+	int32 GetNumLoads() const { return NumLoads; }
+	double GetLastLoadSeconds() const { return LastLoadSeconds; }
+	double GetMaxLoadSeconds() const { return MaxLoadSeconds; }
+	double GetTotalLoadSeconds() const { return TotalLoadSeconds; }
+
+private:
+	FVector Location = FVector::ZeroVector;
+	double StartTime = 0.0;
+	bool bPending = false;
+
+	int32 NumLoads = 0;
+	double LastLoadSeconds = 0.0;
+	double MaxLoadSeconds = 0.0;
+	double TotalLoadSeconds = 0.0;
+};
+
+namespace BodycamStreaming
+{
+	/** True when the cells within Radius of Location have reached the loaded state. */
+	BODYCAMHORRORGAME_API bool IsLoaded(const UWorldPartitionSubsystem& WorldPartition, const FVector& Location, float Radius, bool bActivated);
+}
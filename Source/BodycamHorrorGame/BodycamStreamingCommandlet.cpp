@@ -0,0 +1,211 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+
+#include "BodycamStreamingCommandlet.h"
+#include "BodycamHorrorGame.h"
+#include "BodycamBenchmarkCommandlet.h"
+#include "BodycamCharacter.h"
+#include "BodycamStreaming.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerStart.h"
+#include "WorldPartition/WorldPartitionSubsystem.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/IConsoleManager.h"
+
+namespace BodycamStreamingRoute
+{
+	static constexpr float FixedDeltaSeconds = 1.f / 60.f;
+	static constexpr float WaypointRadius = 150.f;   // cm
+	static constexpr float SquareSide = 12000.f;     // default route (cm)
+	static constexpr float TurnRate = 240.f;         // deg/s, roughly a mouse turn
+	static constexpr float StallRadius = 1500.f;     // cells around the pawn that must be activated
+}
+
+UBodycamStreamingCommandlet::UBodycamStreamingCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UBodycamStreamingCommandlet::Main(const FString& Params)
+{
+	FString MapPath = TEXT("/Game/Saves/Untitled");
+	FParse::Value(*Params, TEXT("Map="), MapPath);
+
+	// absolute X,Y waypoints; empty = square around the player start
+	TArray<FVector2D> Route;
+	FString RouteStr;
+	if (FParse::Value(*Params, TEXT("Route="), RouteStr, false))
+	{
+		TArray<FString> Points;
+		RouteStr.ParseIntoArray(Points, TEXT(";"));
+		for (const FString& Point : Points)
+		{
+			FString X, Y;
+			if (Point.Split(TEXT(","), &X, &Y))
+			{
+				Route.Add(FVector2D(FCString::Atof(*X), FCString::Atof(*Y)));
+			}
+		}
+	}
+
+	int32 Pairs = 1;
+	float MaxSeconds = 300.f;
+	FParse::Value(*Params, TEXT("Pairs="), Pairs);
+	FParse::Value(*Params, TEXT("MaxSeconds="), MaxSeconds);
+
+	FString OutDir = FPaths::ProjectSavedDir() / TEXT("Profiling/Bodycam");
+	FParse::Value(*Params, TEXT("Out="), OutDir);
+
+	// off first: the second load of a pair gets the warmer file cache, which favours "off" if anything
+	TArray<FRun> Runs;
+	for (int32 Pair = 0; Pair < FMath::Max(1, Pairs); ++Pair)
+	{
+		for (const bool bPredict : { false, true })
+		{
+			FRun& Run = Runs.AddDefaulted_GetRef();
+			if (!RunRoute(MapPath, Route, bPredict, MaxSeconds, Run))
+			{
+				UE_LOG(LogBodycam, Error, TEXT("Could not run the route on %s"), *MapPath);
+				return 1;
+			}
+			UE_LOG(LogBodycam, Display, TEXT("predict %-3s route %.1f s%s | stalls %d frames in %d episodes, longest %.0f ms | predicted loads %d, mean %.0f ms, max %.0f ms"),
+				bPredict ? TEXT("on") : TEXT("off"), Run.RouteSeconds, Run.bCompleted ? TEXT("") : TEXT(" (timed out)"),
+				Run.StallFrames, Run.StallEpisodes, Run.LongestStallMs, Run.PredictedLoads, Run.MeanLoadMs, Run.MaxLoadMs);
+		}
+	}
+
+	WriteResults(Runs, MapPath, OutDir);
+	return 0;
+}
+
+bool UBodycamStreamingCommandlet::RunRoute(const FString& MapPath, const TArray<FVector2D>& Route, bool bPredict, float MaxSeconds, FRun& OutRun)
+{
+	if (IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("bodycam.Streaming.Predict")))
+	{
+		CVar->Set(bPredict ? 1 : 0);
+	}
+
+	UWorld* World = UBodycamBenchmarkCommandlet::LoadMapWorld(MapPath);
+	if (!World)
+	{
+		return false;
+	}
+
+	const UWorldPartitionSubsystem* WorldPartition = World->GetSubsystem<UWorldPartitionSubsystem>();
+	if (!World->IsPartitionedWorld() || !WorldPartition)
+	{
+		UE_LOG(LogBodycam, Error, TEXT("%s is not a World Partition map"), *MapPath);
+		UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+		return false;
+	}
+
+	FTransform Start(FVector(0.f, 0.f, 200.f));
+	for (TActorIterator<APlayerStart> It(World); It; ++It)
+	{
+		Start = It->GetActorTransform();
+		break;
+	}
+
+	// a local player controller makes the pawn locally controlled and is the regular streaming source
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	APlayerController* PC = World->SpawnActor<APlayerController>(APlayerController::StaticClass(), Start, SpawnParams);
+	ABodycamCharacter* Pawn = World->SpawnActor<ABodycamCharacter>(ABodycamCharacter::StaticClass(), Start, SpawnParams);
+	if (!PC || !Pawn)
+	{
+		UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+		return false;
+	}
+	PC->Possess(Pawn);
+	Pawn->SetSprinting(true);
+
+	TArray<FVector2D> Waypoints = Route;
+	if (Waypoints.Num() == 0)
+	{
+		const FVector2D Origin(Start.GetLocation());
+		const float Side = BodycamStreamingRoute::SquareSide;
+		Waypoints = { Origin + FVector2D(Side, 0.f), Origin + FVector2D(Side, Side), Origin + FVector2D(0.f, Side), Origin };
+	}
+
+	OutRun.bPredict = bPredict;
+	const float Dt = BodycamStreamingRoute::FixedDeltaSeconds;
+	const int32 MaxFrames = FMath::CeilToInt(MaxSeconds / Dt);
+	int32 Waypoint = 0;
+	int32 StallRun = 0;
+
+	for (int32 Frame = 0; Frame < MaxFrames && Waypoint < Waypoints.Num(); ++Frame)
+	{
+		const double FrameStart = FPlatformTime::Seconds();
+
+		// steer at the current waypoint with a finite turn rate, so facing leads velocity like a player's
+		const FVector2D ToTarget = Waypoints[Waypoint] - FVector2D(Pawn->GetActorLocation());
+		if (ToTarget.Size() < BodycamStreamingRoute::WaypointRadius)
+		{
+			++Waypoint;
+			continue;
+		}
+		const FRotator Desired(0.f, FMath::RadiansToDegrees(FMath::Atan2(ToTarget.Y, ToTarget.X)), 0.f);
+		PC->SetControlRotation(FMath::RInterpConstantTo(PC->GetControlRotation(), Desired, Dt, BodycamStreamingRoute::TurnRate));
+		Pawn->AddMovementInput(PC->GetControlRotation().Vector(), 1.f);
+
+		World->Tick(LEVELTICK_All, Dt);
+		StaticTick(Dt, true);
+		++GFrameCounter;
+		++OutRun.Frames;
+
+		if (!BodycamStreaming::IsLoaded(*WorldPartition, Pawn->GetActorLocation(), BodycamStreamingRoute::StallRadius, true))
+		{
+			++OutRun.StallFrames;
+			if (StallRun++ == 0)
+			{
+				++OutRun.StallEpisodes;
+			}
+			OutRun.LongestStallMs = FMath::Max(OutRun.LongestStallMs, StallRun * Dt * 1000.f);
+		}
+		else
+		{
+			StallRun = 0;
+		}
+
+		// real time, so streaming gets the same wall clock budget it would in game
+		const double Remaining = Dt - (FPlatformTime::Seconds() - FrameStart);
+		if (Remaining > 0.0)
+		{
+			FPlatformProcess::Sleep((float)Remaining);
+		}
+	}
+
+	OutRun.bCompleted = Waypoint >= Waypoints.Num();
+	OutRun.RouteSeconds = OutRun.Frames * Dt;
+
+	const FBodycamStreamingProbe& Probe = Pawn->GetStreamingProbe();
+	OutRun.PredictedLoads = Probe.GetNumLoads();
+	OutRun.MeanLoadMs = Probe.GetNumLoads() > 0 ? (float)(Probe.GetTotalLoadSeconds() / Probe.GetNumLoads() * 1000.0) : 0.f;
+	OutRun.MaxLoadMs = (float)(Probe.GetMaxLoadSeconds() * 1000.0);
+
+	UBodycamBenchmarkCommandlet::DestroyBenchmarkWorld(World);
+	return true;
+}
+
+void UBodycamStreamingCommandlet::WriteResults(const TArray<FRun>& Runs, const FString& MapPath, const FString& OutDir) const
+{
+	const FString Stamp = FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"));
+	const FString CsvPath = OutDir / FString::Printf(TEXT("BodycamStreaming-%s.csv"), *Stamp);
+
+	FString Csv = TEXT("map,predict,completed,route_s,frames,stall_frames,stall_episodes,longest_stall_ms,predicted_loads,mean_load_ms,max_load_ms\n");
+	for (const FRun& Run : Runs)
+	{
+		Csv += FString::Printf(TEXT("%s,%d,%d,%.2f,%d,%d,%d,%.1f,%d,%.1f,%.1f\n"),
+			*MapPath, Run.bPredict ? 1 : 0, Run.bCompleted ? 1 : 0, Run.RouteSeconds, Run.Frames,
+			Run.StallFrames, Run.StallEpisodes, Run.LongestStallMs, Run.PredictedLoads, Run.MeanLoadMs, Run.MaxLoadMs);
+	}
+
+	FFileHelper::SaveStringToFile(Csv, *CsvPath);
+	UE_LOG(LogBodycam, Display, TEXT("Streaming results written to %s"), *CsvPath);
+}
@@ -0,0 +1,48 @@
+// Copyright belongs to Real Interactive Studio, 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BodycamStreamingCommandlet.generated.h"
+
+/**
+ * Headless World Partition streaming check for the predictive streaming source.
+ *
+ *   UnrealEditor-Cmd BodycamHorrorGame -run=BodycamStreaming -nullrhi -unattended
+ *       [-Map=/Game/Saves/Untitled] [-Route=X,Y;X,Y;...] [-Pairs=1] [-MaxSeconds=300] [-Out=<dir>]
+ *
+ * Loads the map as a game world, possesses a bodycam pawn at the player start and sprints it
+ * along the route (default: a 120 m square from the start), ticking in real time at 60 Hz so
+ * loading keeps its real pace. Every frame where the cells around the pawn are not activated
+ * counts as a stall. Each pair runs with bodycam.Streaming.Predict off, then on, each in a fresh
+ * load of the map. Writes a CSV to Saved/Profiling/Bodycam.
+ */
+UCLASS()
+class UBodycamStreamingCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBodycamStreamingCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	struct FRun
+	{
+		bool bPredict = false;
+		float RouteSeconds = 0.f;
+		bool bCompleted = false;
+		int32 Frames = 0;
+		int32 StallFrames = 0;
+		int32 StallEpisodes = 0;
+		float LongestStallMs = 0.f;
+		int32 PredictedLoads = 0;
+		float MeanLoadMs = 0.f;
+		float MaxLoadMs = 0.f;
+	};
+
+private:
+	bool RunRoute(const FString& MapPath, const TArray<FVector2D>& Route, bool bPredict, float MaxSeconds, FRun& OutRun);
+	void WriteResults(const TArray<FRun>& Runs, const FString& MapPath, const FString& OutDir) const;
+};